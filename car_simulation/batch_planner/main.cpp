@@ -0,0 +1,614 @@
+// Headless planner that reads planning jobs and streams the routes found for
+// them to the standard output. It does not depend on GLUT so it can be run on
+// machines without a display.
+//
+// Every job is described on a single line:
+//   <layout file> <width> <length> <max steering angle> <center> <second point>
+//   [<parking lot>]
+// The car description and the start pose follow the format of
+// resources/input.in. If the index of a parking lot of the layout is given
+// the car is routed to it with a bidirectional search, otherwise to any
+// parking lot. Empty lines and lines starting with '#' are skipped.
+// Jobs are read from the files passed as arguments or from the standard input
+// if no files are given.
+//
+// Options:
+//   --threads=N  build the positions graph with N threads (0 means one per
+//                hardware thread). The default is a serial build.
+//   --eager      compute all the edges of the graph before routing instead of
+//                lazily during the search.
+//   --astar      search with A* instead of Dijkstra. The routes found have
+//                the same length.
+//   --share-graph  plan consecutive jobs with the same layout and car on a
+//                single graph holding all their start positions. The start
+//                positions of the other jobs may then shorten a route.
+//   --tree       build the shortest path tree towards the final positions
+//                once per graph and read all the routes from it.
+//   --tree-cache=DIR  same as --tree but the tree is loaded from DIR if it
+//                was saved there for the same graph and start positions, and
+//                saved there otherwise. Every tree has its own file, named
+//                after the key of its graph.
+//   --graph-cache=DIR  load the graph of the layout from DIR if it was saved
+//                there for the same layout, car, grid and manuever options,
+//                and build and save it there otherwise. The start positions
+//                of the jobs are connected to the loaded graph, so one file
+//                serves all the jobs on a layout. Implies --eager.
+//   --manuever-library=DIR  take the manuevers between the positions of the
+//                sampling lattice of an object from a library solved once per
+//                car model, so that only their collisions are checked. The
+//                libraries are loaded from DIR, or built and saved there, and
+//                are shared by all the jobs with the same car.
+//   --manuever-reach=D  connect the positions whose centers are closer than
+//                D diameters of the tightest turn of the car (2.5 by
+//                default). A bigger reach may find shorter routes but tries
+//                more manuevers per position.
+//   --fixed-grid  index the boundary lines with a grid of fixed size over the
+//                whole world instead of one fitted to the layout.
+//   --compare-grids  before planning on a layout, index it with both grids,
+//                run the same collision queries of the car of the job on
+//                each and print their latency and memory. Any query the grids
+//                answer differently is counted.
+//   --benchmark  print the times and the counters of the benchmarked scopes
+//                and the statistics of the collision cache when done.
+
+#include "geometry/bounding_box.h"
+#include "geometry/geometry_utils.h"
+#include "geometry/point.h"
+#include "geometry/polygon.h"
+#include "geometry/rectangle_object.h"
+#include "geometry/regular_grid.h"
+#include "geometry/vector.h"
+#include "simulation/car_description.h"
+#include "simulation/car_manuever.h"
+#include "simulation/car_movement_handler.h"
+#include "simulation/car_position.h"
+#include "simulation/car_positions_graph.h"
+#include "simulation/car_positions_graph_router.h"
+#include "simulation/manuever_library.h"
+#include "utils/benchmark.h"
+#include "utils/boundary_line_holder.h"
+#include "utils/car_positions_graph_builder.h"
+#include "utils/delay.h"
+#include "utils/double_utils.h"
+#include "utils/intersection_handler.h"
+#include "utils/object_holder.h"
+#include "utils/scoped_ptr.h"
+#include "utils/thread_pool.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+static const double MIN_X_COORDINATE = -250.0;
+static const double MAX_X_COORDINATE = 250.0;
+static const double MIN_Y_COORDINATE = -150.0;
+static const double MAX_Y_COORDINATE = 150.0;
+
+// Holds everything that depends only on the layout so that jobs planned on
+// the same layout do not parse it and build its boundary lines again.
+struct LayoutContext {
+  LayoutContext()
+    : intersectionHandler(MIN_X_COORDINATE, MAX_X_COORDINATE,
+                          MIN_Y_COORDINATE, MAX_Y_COORDINATE,
+                          &boundaryLinesHolder),
+      gridsCompared(false) {}
+
+  utils::ObjectHolder objectHolder;
+  utils::BoundaryLinesHolder boundaryLinesHolder;
+  utils::IntersectionHandler intersectionHandler;
+  // Set once the grids were compared on the layout for --compare-grids.
+  bool gridsCompared;
+};
+
+// The number of car positions queried on each grid by CompareGrids.
+static const int NUMBER_OF_GRID_QUERIES = 200000;
+
+struct PlanningJob {
+  string layoutPath;
+  double width, length, maxSteeringAngle;
+  simulation::CarPosition start;
+  // The index of the target parking lot or -1 for any.
+  int parkingLot;
+};
+
+typedef map<string, LayoutContext*> LayoutCache;
+
+// The manuever libraries loaded so far by the names of their files.
+typedef map<string, simulation::ManueverLibrary*> ManueverLibraryCache;
+
+bool ParseJob(const string& line, PlanningJob* job) {
+  istringstream in(line);
+  geometry::Point center, second_point;
+  if (!(in >> job->layoutPath >> job->width >> job->length >>
+        job->maxSteeringAngle)) {
+    return false;
+  }
+  in >> center >> second_point;
+  if (!in) {
+    return false;
+  }
+  if (!(in >> job->parkingLot)) {
+    job->parkingLot = -1;
+  }
+  job->maxSteeringAngle =
+      geometry::GeometryUtils::DegreesToRadians(job->maxSteeringAngle);
+  job->start.SetCenter(center);
+  job->start.SetDirection(geometry::Vector(center, second_point));
+  return true;
+}
+
+LayoutContext* GetLayout(const string& layout_path, bool adaptive_grid,
+                         LayoutCache* cache) {
+  LayoutCache::iterator it = cache->find(layout_path);
+  if (it != cache->end()) {
+    return it->second;
+  }
+
+  LayoutContext* layout = new LayoutContext();
+  try {
+    layout->objectHolder.ParseFromFile(layout_path);
+    layout->intersectionHandler.SetAdaptiveGrid(adaptive_grid);
+    layout->intersectionHandler.Init(layout->objectHolder);
+  } catch (...) {
+    delete layout;
+    throw;
+  }
+  cache->insert(make_pair(layout_path, layout));
+  return layout;
+}
+
+// Indexes the layout of "layout_path" with an adaptive and with a fixed grid
+// and queries both with the bounds of the car of "description" at the same
+// random positions over the layout.
+void CompareGrids(const string& layout_path,
+                  const simulation::CarDescription& description) {
+  LayoutContext layouts[2];
+  const char* names[] = { "adaptive", "fixed" };
+  for (int k = 0; k < 2; ++k) {
+    layouts[k].objectHolder.ParseFromFile(layout_path);
+    layouts[k].intersectionHandler.SetAdaptiveGrid(k == 0);
+    layouts[k].intersectionHandler.Init(layouts[k].objectHolder);
+  }
+
+  const utils::ObjectHolder& object_holder = layouts[0].objectHolder;
+  const utils::RectangleObjectContainer* containers[] = {
+    &object_holder.GetRoadSegments(),
+    &object_holder.GetParkingLots(),
+    &object_holder.GetObstacles()
+  };
+  geometry::BoundingBox extent;
+  for (unsigned i = 0; i < sizeof(containers) / sizeof(containers[0]); ++i) {
+    for (unsigned index = 0; index < containers[i]->size(); ++index) {
+      extent.UnionWith((*containers[i])[index]->GetBoundingBox());
+    }
+  }
+  if (extent.IsEmpty()) {
+    return;
+  }
+
+  vector<geometry::Polygon> queries(NUMBER_OF_GRID_QUERIES);
+  srand(1);
+  for (int i = 0; i < NUMBER_OF_GRID_QUERIES; ++i) {
+    double x = extent.GetMinX() +
+        (extent.GetMaxX() - extent.GetMinX()) * rand() / RAND_MAX;
+    double y = extent.GetMinY() +
+        (extent.GetMaxY() - extent.GetMinY()) * rand() / RAND_MAX;
+    double angle = 2.0 * geometry::GeometryUtils::PI * rand() / RAND_MAX;
+    simulation::CarPosition position;
+    position.SetCenter(geometry::Point(x, y));
+    position.SetDirection(geometry::Vector(cos(angle), sin(angle)));
+    description.GetBounds(position, queries[i]);
+  }
+
+  vector<bool> answers[2];
+  vector<geometry::SegmentSpan> spans;
+  for (int k = 0; k < 2; ++k) {
+    const utils::IntersectionHandler& handler =
+        layouts[k].intersectionHandler;
+    answers[k].resize(NUMBER_OF_GRID_QUERIES);
+    // The first pass warms up the caches and grows "spans".
+    for (int pass = 0; pass < 2; ++pass) {
+      double start_time = get_wall_time();
+      for (int i = 0; i < NUMBER_OF_GRID_QUERIES; ++i) {
+        answers[k][i] =
+            handler.GetIntersectedBoundarySegment(queries[i], &spans) != NULL;
+      }
+      double elapsed = get_wall_time() - start_time;
+      if (pass == 1) {
+        cerr << "Grid " << names[k] << " " << layout_path << ": "
+             << setprecision(4)
+             << elapsed * 1e9 / NUMBER_OF_GRID_QUERIES << " ns per query, "
+             << handler.GetMemoryUsage() / 1024 << " KB" << endl;
+      }
+    }
+  }
+
+  int differences = 0;
+  for (int i = 0; i < NUMBER_OF_GRID_QUERIES; ++i) {
+    if (answers[0][i] != answers[1][i]) {
+      ++differences;
+    }
+  }
+  cerr << "Grids compared on " << NUMBER_OF_GRID_QUERIES << " queries, "
+       << differences << " answered differently" << endl;
+}
+
+// Returns the manuever library of the car of "description" from "cache",
+// loading it from "directory" or building and saving it there if it is not
+// in the cache yet.
+simulation::ManueverLibrary* GetManueverLibrary(
+    const string& directory, const simulation::CarDescription& description,
+    ManueverLibraryCache* cache) {
+  simulation::ManueverLibrary* library = new simulation::ManueverLibrary(
+      description, utils::CarPositionsGraphBuilder::GetSamplingStep(),
+      utils::CarPositionsGraphBuilder::GetNumberOfHeadings());
+  string file = directory + "/" + library->GetFileName();
+  ManueverLibraryCache::iterator it = cache->find(file);
+  if (it != cache->end()) {
+    delete library;
+    return it->second;
+  }
+
+  try {
+    library->Load(file);
+  } catch (const exception& e) {
+    cerr << "Rebuilding " << file << ": " << e.what() << endl;
+    library->Build();
+    try {
+      library->Save(file);
+    } catch (const exception& e) {
+      cerr << e.what() << endl;
+    }
+  }
+  cache->insert(make_pair(file, library));
+  return library;
+}
+
+// Returns the path of the file in "directory" for the graph or the tree with
+// "key", named after the key as the manuever libraries are after their hash.
+string GetCacheFilePath(const string& directory, const string& prefix,
+                        unsigned long long key, const string& extension) {
+  ostringstream path;
+  path << directory << "/" << prefix << "_" << hex << setw(16)
+       << setfill('0') << key << extension;
+  return path.str();
+}
+
+void PrintRoute(int job_index, const PlanningJob& job,
+                const vector<simulation::CarManuever>& route) {
+  double total_distance = 0.0;
+  for (unsigned i = 0; i < route.size(); ++i) {
+    total_distance += route[i].GetTotalDistance();
+  }
+  cout << "job " << job_index << " " << job.layoutPath << " "
+       << (route.empty() ? "not_found" : "found") << " "
+       << route.size() << " " << total_distance << "\n";
+  for (unsigned i = 0; i < route.size(); ++i) {
+    const simulation::CarManuever& manuever = route[i];
+    simulation::CarPosition begin = manuever.GetBeginPosition();
+    cout << "manuever " << begin.GetCenter() << " " << begin.GetDirection()
+         << " " << manuever.GetInitialStraightSectionDistance()
+         << " " << manuever.GetTurnAngle()
+         << " " << manuever.GetRotationCenter()
+         << " " << manuever.GetFinalStraightSectionDistance()
+         << " " << manuever.IsReversed() << "\n";
+  }
+  cout.flush();
+}
+
+struct PlannerOptions {
+  PlannerOptions()
+    : numberOfThreads(1), computeEdgesEagerly(false),
+      searchAlgorithm(simulation::CarPositionsGraphRouter::DIJKSTRA),
+      shareGraph(false), computeTree(false), adaptiveGrid(true),
+      compareGrids(false), manueverReach(0.0) {}
+
+  int numberOfThreads;
+  bool computeEdgesEagerly;
+  simulation::CarPositionsGraphRouter::SearchAlgorithm searchAlgorithm;
+  bool shareGraph;
+  bool computeTree;
+  string treeCacheDirectory;
+  string graphCacheDirectory;
+  string manueverLibraryDirectory;
+  bool adaptiveGrid;
+  bool compareGrids;
+  // In diameters of the tightest turn of the car or 0 for the default.
+  double manueverReach;
+};
+
+struct PlannerStats {
+  PlannerStats()
+    : jobs(0), routesFound(0), expandedVertices(0), collisionCacheHits(0),
+      collisionCacheMisses(0) {}
+
+  int jobs;
+  int routesFound;
+  int expandedVertices;
+  unsigned long long collisionCacheHits;
+  unsigned long long collisionCacheMisses;
+};
+
+// Jobs with the same layout and car can be planned on a single graph.
+bool CanShareGraph(const PlanningJob& first, const PlanningJob& second) {
+  return first.layoutPath == second.layoutPath &&
+      DoubleEquals(first.width, second.width) &&
+      DoubleEquals(first.length, second.length) &&
+      DoubleEquals(first.maxSteeringAngle, second.maxSteeringAngle);
+}
+
+void PrintError(int job_index, const PlanningJob& job, const string& error) {
+  cout << "job " << job_index << " " << job.layoutPath << " error "
+       << error << endl;
+}
+
+// Loads the tree to the final positions from the file for "key" in
+// "directory" or computes it and saves it there if the file is missing or is
+// for another graph. "key" identifies the graph of "router" and its start
+// positions. The tree is only computed if "directory" is empty.
+void GetTree(const string& directory, unsigned long long key,
+             simulation::CarPositionsGraphRouter* router) {
+  if (directory.empty()) {
+    router->ComputeTreeToFinalPositions();
+    return;
+  }
+
+  string file = GetCacheFilePath(directory, "tree", key, ".txt");
+  ifstream in(file.c_str());
+  if (in) {
+    try {
+      router->LoadTreeToFinalPositions(in, key);
+      return;
+    } catch (const exception& e) {
+      cerr << "Rebuilding " << file << ": " << e.what() << endl;
+    }
+  }
+
+  router->ComputeTreeToFinalPositions();
+  ofstream out(file.c_str());
+  router->SaveTreeToFinalPositions(out, key);
+  out.close();
+  if (!out) {
+    cerr << "The tree is not cached: could not write " << file << endl;
+  }
+}
+
+// Plans all the jobs on one graph holding the start positions of all of
+// them and answers them with one router. All the jobs should be able to
+// share a graph.
+void PlanJobs(const vector<PlanningJob>& jobs, const PlannerOptions& options,
+              LayoutCache* cache, ManueverLibraryCache* library_cache,
+              utils::ThreadPool* thread_pool, PlannerStats* stats) {
+  const PlanningJob& first_job = jobs.front();
+  int first_job_index = stats->jobs;
+  stats->jobs += jobs.size();
+  unsigned next_job = 0;
+  try {
+    LayoutContext* layout =
+        GetLayout(first_job.layoutPath, options.adaptiveGrid, cache);
+    simulation::CarDescription description(
+        first_job.width, first_job.length, first_job.maxSteeringAngle);
+    if (options.compareGrids && !layout->gridsCompared) {
+      CompareGrids(first_job.layoutPath, description);
+      layout->gridsCompared = true;
+    }
+    simulation::CarMovementHandler movement_handler(
+        &layout->intersectionHandler, description);
+    simulation::CarPositionsGraph graph(&movement_handler);
+    if (options.manueverReach > 0.0) {
+      graph.SetManueverReach(options.manueverReach);
+    }
+    if (!options.manueverLibraryDirectory.empty()) {
+      graph.SetManueverLibrary(GetManueverLibrary(
+          options.manueverLibraryDirectory, description, library_cache));
+    }
+
+    // The start positions are added before all the others, so they get the
+    // first indices.
+    vector<int> start_indices(jobs.size(), -1);
+    int number_of_starts = 0;
+    for (unsigned i = 0; i < jobs.size(); ++i) {
+      utils::RectangleObjectContainer car_objects;
+      layout->objectHolder.GetObectsForLocation(
+          jobs[i].start.GetCenter(), &car_objects);
+      if (!car_objects.empty()) {
+        graph.AddPosition(jobs[i].start, car_objects.front());
+        start_indices[i] = number_of_starts++;
+      }
+    }
+
+    simulation::CarPositionsGraphRouter router(&graph);
+    router.SetSearchAlgorithm(options.searchAlgorithm);
+    if (number_of_starts > 0) {
+      utils::CarPositionsGraphBuilder builder(
+          layout->objectHolder, layout->intersectionHandler);
+      builder.SetThreadPool(thread_pool);
+      builder.SetComputeEdgesEagerly(options.computeEdgesEagerly);
+      if (!options.graphCacheDirectory.empty() ||
+          !options.treeCacheDirectory.empty()) {
+        builder.SetLayoutFile(first_job.layoutPath);
+      }
+      if (!options.graphCacheDirectory.empty()) {
+        builder.SetGraphCacheFile(
+            GetCacheFilePath(options.graphCacheDirectory, "graph",
+                             builder.GetGraphKey(graph), ".bin"),
+            first_job.layoutPath);
+      }
+      builder.CreateCarPositionsGraph(&graph);
+      if (options.computeTree) {
+        unsigned long long key = 0;
+        if (!options.treeCacheDirectory.empty()) {
+          key = builder.GetGraphKeyWithFixedPositions(graph);
+        }
+        GetTree(options.treeCacheDirectory, key, &router);
+        stats->expandedVertices += router.GetNumberOfExpandedVertices();
+      }
+    }
+
+    for (; next_job < jobs.size(); ++next_job) {
+      int job_index = first_job_index + next_job;
+      if (start_indices[next_job] == -1) {
+        PrintError(job_index, jobs[next_job],
+                   "The car should be located within a passable area.");
+        continue;
+      }
+      vector<simulation::CarManuever> route;
+      int parking_lot = jobs[next_job].parkingLot;
+      if (parking_lot == -1) {
+        route = router.GetRoute(start_indices[next_job]);
+      } else {
+        const utils::RectangleObjectContainer& parking_lots =
+            layout->objectHolder.GetParkingLots();
+        if (parking_lot < 0 ||
+            parking_lot >= static_cast<int>(parking_lots.size())) {
+          PrintError(job_index, jobs[next_job], "No such parking lot.");
+          continue;
+        }
+        route = router.GetRouteToObject(start_indices[next_job],
+                                        parking_lots[parking_lot]);
+      }
+      stats->expandedVertices += router.GetNumberOfExpandedVertices();
+      PrintRoute(job_index, jobs[next_job], route);
+      if (!route.empty()) {
+        ++stats->routesFound;
+      }
+    }
+    simulation::CollisionCache::Stats cache_stats =
+        movement_handler.GetCollisionCache().GetStats();
+    stats->collisionCacheHits += cache_stats.hits;
+    stats->collisionCacheMisses += cache_stats.misses;
+  } catch (const exception& e) {
+    for (; next_job < jobs.size(); ++next_job) {
+      PrintError(first_job_index + next_job, jobs[next_job], e.what());
+    }
+  }
+}
+
+void ProcessJobs(istream& in, const PlannerOptions& options,
+                 LayoutCache* cache, ManueverLibraryCache* library_cache,
+                 utils::ThreadPool* thread_pool, PlannerStats* stats) {
+  vector<PlanningJob> jobs;
+  string line;
+  while (getline(in, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    PlanningJob job;
+    if (!ParseJob(line, &job)) {
+      cerr << "Skipping malformed job: " << line << endl;
+      continue;
+    }
+
+    if (!jobs.empty() &&
+        (!options.shareGraph || !CanShareGraph(jobs.front(), job))) {
+      PlanJobs(jobs, options, cache, library_cache, thread_pool, stats);
+      jobs.clear();
+    }
+    jobs.push_back(job);
+  }
+  if (!jobs.empty()) {
+    PlanJobs(jobs, options, cache, library_cache, thread_pool, stats);
+  }
+}
+
+int main(int argc, char** argv) {
+  const string threads_option = "--threads=";
+  const string tree_cache_option = "--tree-cache=";
+  const string graph_cache_option = "--graph-cache=";
+  const string manuever_library_option = "--manuever-library=";
+  const string manuever_reach_option = "--manuever-reach=";
+  PlannerOptions options;
+  bool dump_benchmark = false;
+  vector<string> job_files;
+  for (int i = 1; i < argc; ++i) {
+    string argument = argv[i];
+    if (argument.compare(0, threads_option.size(), threads_option) == 0) {
+      options.numberOfThreads =
+          atoi(argument.c_str() + threads_option.size());
+    } else if (argument == "--eager") {
+      options.computeEdgesEagerly = true;
+    } else if (argument == "--astar") {
+      options.searchAlgorithm = simulation::CarPositionsGraphRouter::A_STAR;
+    } else if (argument == "--share-graph") {
+      options.shareGraph = true;
+    } else if (argument == "--fixed-grid") {
+      options.adaptiveGrid = false;
+    } else if (argument == "--compare-grids") {
+      options.compareGrids = true;
+    } else if (argument == "--benchmark") {
+      dump_benchmark = true;
+    } else if (argument == "--tree") {
+      options.computeTree = true;
+    } else if (argument.compare(0, tree_cache_option.size(),
+                                tree_cache_option) == 0) {
+      options.computeTree = true;
+      options.treeCacheDirectory = argument.substr(tree_cache_option.size());
+    } else if (argument.compare(0, graph_cache_option.size(),
+                                graph_cache_option) == 0) {
+      options.graphCacheDirectory =
+          argument.substr(graph_cache_option.size());
+    } else if (argument.compare(0, manuever_library_option.size(),
+                                manuever_library_option) == 0) {
+      options.manueverLibraryDirectory =
+          argument.substr(manuever_library_option.size());
+    } else if (argument.compare(0, manuever_reach_option.size(),
+                                manuever_reach_option) == 0) {
+      options.manueverReach =
+          atof(argument.c_str() + manuever_reach_option.size());
+    } else {
+      job_files.push_back(argument);
+    }
+  }
+
+  scoped_ptr<utils::ThreadPool> thread_pool;
+  if (options.numberOfThreads != 1) {
+    thread_pool.reset(new utils::ThreadPool(options.numberOfThreads));
+  }
+
+  LayoutCache cache;
+  ManueverLibraryCache library_cache;
+  PlannerStats stats;
+  double start_time = get_wall_time();
+
+  if (job_files.empty()) {
+    ProcessJobs(cin, options, &cache, &library_cache, thread_pool.get(),
+                &stats);
+  }
+  for (unsigned i = 0; i < job_files.size(); ++i) {
+    ifstream in(job_files[i].c_str());
+    if (!in) {
+      cerr << "Could not open the jobs file " << job_files[i] << endl;
+      continue;
+    }
+    ProcessJobs(in, options, &cache, &library_cache, thread_pool.get(),
+                &stats);
+  }
+
+  cerr << "Planned " << stats.jobs << " jobs (" << stats.routesFound
+       << " routes found, " << stats.expandedVertices
+       << " vertices expanded) in " << setprecision(6) << get_wall_time() - start_time
+       << " seconds" << endl;
+  if (dump_benchmark) {
+    cerr << "Collision cache: " << stats.collisionCacheHits << " hits, "
+         << stats.collisionCacheMisses << " misses" << endl;
+    utils::Benchmark::DumpBenchmarkingInfo();
+  }
+
+  for (LayoutCache::iterator it = cache.begin(); it != cache.end(); ++it) {
+    delete it->second;
+  }
+  for (ManueverLibraryCache::iterator it = library_cache.begin();
+       it != library_cache.end(); ++it) {
+    delete it->second;
+  }
+  return 0;
+}
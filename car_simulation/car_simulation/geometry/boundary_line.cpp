@@ -1,15 +1,15 @@
-#include "geometry/boundary_line.h"
-
-namespace geometry {
-
-BoundaryLine::BoundaryLine() : crossable_(false) {}
-
-bool BoundaryLine::IsCrossable() const {
-  return crossable_;
-}
-
-void BoundaryLine::SetIsCrossable(bool crossable) {
-  crossable_ = crossable;
-}
-
+#include "geometry/boundary_line.h"
+
+namespace geometry {
+
+BoundaryLine::BoundaryLine() : crossable_(false) {}
+
+bool BoundaryLine::IsCrossable() const {
+  return crossable_;
+}
+
+void BoundaryLine::SetIsCrossable(bool crossable) {
+  crossable_ = crossable;
+}
+
 }  // namespace geometry
\ No newline at end of file
@@ -1,200 +1,356 @@
-#include "regular_grid.h"
-
-#include "geometry/bounding_box.h"
-#include "geometry/boundary_line.h"
-#include "geometry/rectangle_object.h"
-#include "utils/double_utils.h"
-
-#include <set>
-#include <vector>
-
-namespace geometry {
-
-static const int VERTICAL_CELL_NUM = 80;
-static const int HORIZONTAL_CELL_NUM = 120;
-
-void GridElement::AddRectangleObject(const RectangleObject* rectangle_object) {
-  rectangleObjects_.push_back(rectangle_object);
-}
-
-void GridElement::AddBoundaryLine(const BoundaryLine* boundary_line) {
-  allBoundaryLines_.push_back(boundary_line);
-}
-
-void GridElement::AddOriginatingBoundaryLine(
-    const BoundaryLine* boundary_line) {
-  allBoundaryLines_.push_back(boundary_line);
-  originatingBoundaryLines_.push_back(boundary_line);
-}
-
-void GridElement::RemoveBoundaryLine(const BoundaryLine* boundary_line) {
-  for (unsigned index = 0; index < allBoundaryLines_.size(); ++index) {
-    if (allBoundaryLines_[index] == boundary_line) {
-      allBoundaryLines_[index] = allBoundaryLines_.back();
-      allBoundaryLines_.pop_back();
-      break;
-    }
-  }
-  for (unsigned index = 0; index < originatingBoundaryLines_.size(); ++index) {
-    if (originatingBoundaryLines_[index] == boundary_line) {
-      originatingBoundaryLines_[index] = originatingBoundaryLines_.back();
-      originatingBoundaryLines_.pop_back();
-      break;
-    }
-  }
-}
-
-const std::vector<const RectangleObject*>& 
-    GridElement::GetRectangleObjects() const {
-  return rectangleObjects_;    
-}
-
-const std::vector<const BoundaryLine*>&
-    GridElement::GetAllBoudnaryLines() const {
-  return allBoundaryLines_;
-}
-
-const std::vector<const BoundaryLine*>&
-    GridElement::GetOriginatingBoudnaryLines() const {
-  return originatingBoundaryLines_;
-}
-
-RegularGrid::RegularGrid(double minx, double maxx, double miny, double maxy)
-    : minx_(minx), maxx_(maxx), miny_(miny), maxy_(maxy) {
-  grid_.resize(VERTICAL_CELL_NUM, std::vector<GridElement>(
-      HORIZONTAL_CELL_NUM));
-}
-
-void RegularGrid::AddRectangleObject(const RectangleObject* object) {
-  BoundingBox bounding_box = object->GetBoundingBox();
-
-  int mini, maxi;
-  int minj, maxj;
-
-  GetCellCoordinates(bounding_box.GetMinX(), bounding_box.GetMinY(),
-      mini, minj);
-  GetCellCoordinates(bounding_box.GetMaxX(), bounding_box.GetMaxY(),
-      maxi, maxj);
-  for (int i = mini; i <= maxi; ++i) {
-    for (int j = minj; j <= maxj; ++j) {
-      grid_[i][j].AddRectangleObject(object);
-    }
-  }
-}
-
-void RegularGrid::AddBoundaryLine(const BoundaryLine* border) {
-  BoundingBox bounding_box = border->GetBoundingBox();
-
-  int mini, maxi;
-  int minj, maxj;
-
-  GetCellCoordinates(bounding_box.GetMinX(), bounding_box.GetMinY(),
-      mini, minj);
-  GetCellCoordinates(bounding_box.GetMaxX(), bounding_box.GetMaxY(),
-      maxi, maxj);
-  for (int i = mini; i <= maxi; ++i) {
-    for (int j = minj; j <= maxj; ++j) {
-      if (i == mini || j == minj) {
-        grid_[i][j].AddOriginatingBoundaryLine(border);
-      } else {
-        grid_[i][j].AddBoundaryLine(border);
-      }
-    }
-  }
-}
-
-void RegularGrid::RemoveBoundaryLine(const BoundaryLine* border) {
-  BoundingBox bounding_box = border->GetBoundingBox();
-
-  int mini, maxi;
-  int minj, maxj;
-
-  GetCellCoordinates(bounding_box.GetMinX(), bounding_box.GetMinY(),
-      mini, minj);
-  GetCellCoordinates(bounding_box.GetMinX(), bounding_box.GetMinY(),
-      maxi, maxj);
-  
-  for (int i = mini; i <= maxi; ++i) {
-    for (int j = minj; j <= maxj; ++j) {
-      grid_[i][j].RemoveBoundaryLine(border);
-    }
-  }
-}
-
-std::vector<const RectangleObject*> RegularGrid::GetRectangleObjects(
-    const BoundingBox& bounding_box) const {
-  int mini, maxi;
-  int minj, maxj;
-  GetCellCoordinates(bounding_box.GetMinX(), bounding_box.GetMinY(),
-      mini, minj);
-  GetCellCoordinates(bounding_box.GetMaxX(), bounding_box.GetMaxY(),
-      maxi, maxj);
-  std::set<const RectangleObject*> rectangle_objects;
-  for (int i = mini; i <= maxi; ++i) {
-    for (int j = minj; j <= maxj; ++j) {
-      const std::vector<const RectangleObject*>& objects =
-          grid_[i][j].GetRectangleObjects();
-      rectangle_objects.insert(objects.begin(), objects.end());
-    }
-  }
-
-  return std::vector<const RectangleObject*>(
-      rectangle_objects.begin(), rectangle_objects.end());
-}
-
-std::vector<const RectangleObject*> RegularGrid::GetRectangleObjects() const {
-  geometry::BoundingBox bounding_box(minx_, maxx_, miny_, maxy_);
-  return GetRectangleObjects(bounding_box);
-}
-
-
-void RegularGrid::GetBoundaryLines(const BoundingBox& bounding_box,
-    std::vector<const BoundaryLine*>* result) const {
-  result->clear();
-  int mini, maxi;
-  int minj, maxj;
-  GetCellCoordinates(bounding_box.GetMinX(), bounding_box.GetMinY(),
-      mini, minj);
-  GetCellCoordinates(bounding_box.GetMaxX(), bounding_box.GetMaxY(),
-      maxi, maxj);
-
-  for (int i = mini; i <= maxi; ++i) {
-    for (int j = minj; j <= maxj; ++j) {
-      if (i == mini || j == minj) {
-        const std::vector<const BoundaryLine*>& lines =
-          grid_[i][j].GetAllBoudnaryLines();
-        result->insert(result->end(), lines.begin(), lines.end());
-      } else {
-        const std::vector<const BoundaryLine*>& lines =
-          grid_[i][j].GetOriginatingBoudnaryLines();
-        result->insert(result->end(), lines.begin(), lines.end());
-      }
-    }
-  }
-}
-
-void RegularGrid::GetBoundaryLines(
-    std::vector<const BoundaryLine*>* result) const {
-  geometry::BoundingBox bounding_box(minx_, maxx_, miny_, maxy_);
-  GetBoundaryLines(bounding_box, result);
-}
-
-void RegularGrid::GetCellCoordinates(double x, double y,
-    int& i, int& j) const {
-  i = static_cast<int>(((x - minx_) * VERTICAL_CELL_NUM) / (maxx_ - minx_));
-  if (i >= VERTICAL_CELL_NUM) {
-    i = VERTICAL_CELL_NUM - 1;
-  }
-  if (i < 0) {
-    i = 0;
-  }
-  j = static_cast<int>(((y - miny_) * HORIZONTAL_CELL_NUM) / (maxy_ - miny_));
-  if (j >= HORIZONTAL_CELL_NUM) {
-    j = HORIZONTAL_CELL_NUM - 1;
-  }
-  if (j < 0) {
-    j = 0;
-  }
-}
-
-}  // namespace geometry
+#include "regular_grid.h"
+
+#include "geometry/bounding_box.h"
+#include "geometry/boundary_line.h"
+#include "geometry/rectangle_object.h"
+#include "geometry/straight_boundary_line.h"
+#include "utils/double_utils.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace geometry {
+
+static const int VERTICAL_CELL_NUM = 80;
+static const int HORIZONTAL_CELL_NUM = 120;
+
+void GridElement::AddRectangleObject(int rectangle_object) {
+  rectangleObjects_.push_back(rectangle_object);
+}
+
+void GridElement::AddBoundaryLine(int boundary_line) {
+  allBoundaryLines_.push_back(boundary_line);
+}
+
+void GridElement::AddOriginatingBoundaryLine(int boundary_line) {
+  allBoundaryLines_.push_back(boundary_line);
+  originatingBoundaryLines_.push_back(boundary_line);
+}
+
+void GridElement::RemoveBoundaryLine(int boundary_line) {
+  for (unsigned index = 0; index < allBoundaryLines_.size(); ++index) {
+    if (allBoundaryLines_[index] == boundary_line) {
+      allBoundaryLines_[index] = allBoundaryLines_.back();
+      allBoundaryLines_.pop_back();
+      break;
+    }
+  }
+  for (unsigned index = 0; index < originatingBoundaryLines_.size(); ++index) {
+    if (originatingBoundaryLines_[index] == boundary_line) {
+      originatingBoundaryLines_[index] = originatingBoundaryLines_.back();
+      originatingBoundaryLines_.pop_back();
+      break;
+    }
+  }
+}
+
+const std::vector<int>& 
+    GridElement::GetRectangleObjects() const {
+  return rectangleObjects_;    
+}
+
+const std::vector<int>&
+    GridElement::GetAllBoudnaryLines() const {
+  return allBoundaryLines_;
+}
+
+const std::vector<int>&
+    GridElement::GetOriginatingBoudnaryLines() const {
+  return originatingBoundaryLines_;
+}
+
+size_t GridElement::GetMemoryUsage() const {
+  return sizeof(*this) + (rectangleObjects_.capacity() +
+      allBoundaryLines_.capacity() +
+      originatingBoundaryLines_.capacity()) * sizeof(int);
+}
+
+RegularGrid::RegularGrid(double minx, double maxx, double miny, double maxy) {
+  Reset(minx, maxx, miny, maxy, VERTICAL_CELL_NUM, HORIZONTAL_CELL_NUM);
+}
+
+void RegularGrid::Reset(double minx, double maxx, double miny, double maxy,
+                        int vertical_cells, int horizontal_cells) {
+  minx_ = minx;
+  maxx_ = maxx;
+  miny_ = miny;
+  maxy_ = maxy;
+  verticalCells_ = vertical_cells;
+  horizontalCells_ = horizontal_cells;
+  grid_.assign(verticalCells_, std::vector<GridElement>(horizontalCells_));
+  rectangleObjects_.clear();
+  boundaryLines_.clear();
+  queryStamp_ = 0;
+  rectangleObjectStamps_.clear();
+  boundaryLineStamps_.clear();
+  segments_.clear();
+  segmentArrays_.Clear();
+  cellBegin_.clear();
+  originatingEnd_.clear();
+}
+
+int RegularGrid::GetNumberOfVerticalCells() const {
+  return verticalCells_;
+}
+
+int RegularGrid::GetNumberOfHorizontalCells() const {
+  return horizontalCells_;
+}
+
+void RegularGrid::AddRectangleObject(const RectangleObject* object) {
+  BoundingBox bounding_box = object->GetBoundingBox();
+  int object_index = rectangleObjects_.size();
+  rectangleObjects_.push_back(object);
+  rectangleObjectStamps_.push_back(0);
+
+  int mini, maxi;
+  int minj, maxj;
+
+  GetCellCoordinates(bounding_box.GetMinX(), bounding_box.GetMinY(),
+      mini, minj);
+  GetCellCoordinates(bounding_box.GetMaxX(), bounding_box.GetMaxY(),
+      maxi, maxj);
+  for (int i = mini; i <= maxi; ++i) {
+    for (int j = minj; j <= maxj; ++j) {
+      grid_[i][j].AddRectangleObject(object_index);
+    }
+  }
+}
+
+void RegularGrid::AddBoundaryLine(const BoundaryLine* border) {
+  BoundingBox bounding_box = border->GetBoundingBox();
+  int line_index = boundaryLines_.size();
+  boundaryLines_.push_back(border);
+  boundaryLineStamps_.push_back(0);
+
+  int mini, maxi;
+  int minj, maxj;
+
+  GetCellCoordinates(bounding_box.GetMinX(), bounding_box.GetMinY(),
+      mini, minj);
+  GetCellCoordinates(bounding_box.GetMaxX(), bounding_box.GetMaxY(),
+      maxi, maxj);
+  for (int i = mini; i <= maxi; ++i) {
+    for (int j = minj; j <= maxj; ++j) {
+      if (i == mini || j == minj) {
+        grid_[i][j].AddOriginatingBoundaryLine(line_index);
+      } else {
+        grid_[i][j].AddBoundaryLine(line_index);
+      }
+    }
+  }
+}
+
+void RegularGrid::RemoveBoundaryLine(const BoundaryLine* border) {
+  BoundingBox bounding_box = border->GetBoundingBox();
+
+  int mini, maxi;
+  int minj, maxj;
+
+  GetCellCoordinates(bounding_box.GetMinX(), bounding_box.GetMinY(),
+      mini, minj);
+  GetCellCoordinates(bounding_box.GetMaxX(), bounding_box.GetMaxY(),
+      maxi, maxj);
+  
+  for (int i = mini; i <= maxi; ++i) {
+    for (int j = minj; j <= maxj; ++j) {
+      const std::vector<int>& lines = grid_[i][j].GetAllBoudnaryLines();
+      for (unsigned index = 0; index < lines.size(); ++index) {
+        if (boundaryLines_[lines[index]] == border) {
+          grid_[i][j].RemoveBoundaryLine(lines[index]);
+          break;
+        }
+      }
+    }
+  }
+}
+
+std::vector<const RectangleObject*> RegularGrid::GetRectangleObjects(
+    const BoundingBox& bounding_box) const {
+  std::vector<const RectangleObject*> rectangle_objects;
+  GetRectangleObjects(bounding_box, &rectangle_objects);
+  return rectangle_objects;
+}
+
+std::vector<const RectangleObject*> RegularGrid::GetRectangleObjects() const {
+  geometry::BoundingBox bounding_box(minx_, maxx_, miny_, maxy_);
+  return GetRectangleObjects(bounding_box);
+}
+
+void RegularGrid::GetRectangleObjects(const BoundingBox& bounding_box,
+    std::vector<const RectangleObject*>* result) const {
+  result->clear();
+  int mini, maxi;
+  int minj, maxj;
+  GetCellCoordinates(bounding_box.GetMinX(), bounding_box.GetMinY(),
+      mini, minj);
+  GetCellCoordinates(bounding_box.GetMaxX(), bounding_box.GetMaxY(),
+      maxi, maxj);
+  unsigned stamp = StartQuery();
+  for (int i = mini; i <= maxi; ++i) {
+    for (int j = minj; j <= maxj; ++j) {
+      const std::vector<int>& objects = grid_[i][j].GetRectangleObjects();
+      for (unsigned index = 0; index < objects.size(); ++index) {
+        if (rectangleObjectStamps_[objects[index]] != stamp) {
+          rectangleObjectStamps_[objects[index]] = stamp;
+          result->push_back(rectangleObjects_[objects[index]]);
+        }
+      }
+    }
+  }
+}
+
+void RegularGrid::GetBoundaryLines(const BoundingBox& bounding_box,
+    std::vector<const BoundaryLine*>* result) const {
+  result->clear();
+  int mini, maxi;
+  int minj, maxj;
+  GetCellCoordinates(bounding_box.GetMinX(), bounding_box.GetMinY(),
+      mini, minj);
+  GetCellCoordinates(bounding_box.GetMaxX(), bounding_box.GetMaxY(),
+      maxi, maxj);
+  unsigned stamp = StartQuery();
+  for (int i = mini; i <= maxi; ++i) {
+    for (int j = minj; j <= maxj; ++j) {
+      const std::vector<int>& lines = grid_[i][j].GetAllBoudnaryLines();
+      for (unsigned index = 0; index < lines.size(); ++index) {
+        if (boundaryLineStamps_[lines[index]] != stamp) {
+          boundaryLineStamps_[lines[index]] = stamp;
+          result->push_back(boundaryLines_[lines[index]]);
+        }
+      }
+    }
+  }
+}
+
+void RegularGrid::GetBoundaryLines(
+    std::vector<const BoundaryLine*>* result) const {
+  geometry::BoundingBox bounding_box(minx_, maxx_, miny_, maxy_);
+  GetBoundaryLines(bounding_box, result);
+}
+
+void RegularGrid::BuildSegmentIndex() {
+  // Only straight boundary lines are ever added to the grid.
+  segments_.clear();
+  cellBegin_.clear();
+  originatingEnd_.clear();
+  for (int i = 0; i < verticalCells_; ++i) {
+    for (int j = 0; j < horizontalCells_; ++j) {
+      cellBegin_.push_back(segments_.size());
+      const std::vector<int>& originating =
+          grid_[i][j].GetOriginatingBoudnaryLines();
+      const std::vector<int>& all = grid_[i][j].GetAllBoudnaryLines();
+      for (unsigned index = 0; index < originating.size(); ++index) {
+        segments_.push_back(static_cast<const StraightBoundaryLine*>(
+            boundaryLines_[originating[index]])->GetSegment());
+      }
+      originatingEnd_.push_back(segments_.size());
+
+      // The originating lines are in both lists.
+      for (unsigned index = 0; index < all.size(); ++index) {
+        if (std::find(originating.begin(), originating.end(), all[index]) ==
+            originating.end()) {
+          segments_.push_back(static_cast<const StraightBoundaryLine*>(
+              boundaryLines_[all[index]])->GetSegment());
+        }
+      }
+    }
+  }
+  cellBegin_.push_back(segments_.size());
+
+  segmentArrays_.Clear();
+  segmentArrays_.Reserve(segments_.size());
+  for (unsigned index = 0; index < segments_.size(); ++index) {
+    segmentArrays_.Add(segments_[index]);
+  }
+}
+
+void RegularGrid::GetBoundarySegments(const BoundingBox& bounding_box,
+    std::vector<SegmentSpan>* result) const {
+  result->clear();
+  int mini, maxi;
+  int minj, maxj;
+  GetCellCoordinates(bounding_box.GetMinX(), bounding_box.GetMinY(),
+      mini, minj);
+  GetCellCoordinates(bounding_box.GetMaxX(), bounding_box.GetMaxY(),
+      maxi, maxj);
+
+  const Segment* segments = segments_.empty() ? NULL : &segments_[0];
+  for (int i = mini; i <= maxi; ++i) {
+    for (int j = minj; j <= maxj; ++j) {
+      int cell = i * horizontalCells_ + j;
+      int begin = cellBegin_[cell];
+      int end = (i == mini || j == minj) ?
+          cellBegin_[cell + 1] : originatingEnd_[cell];
+      if (begin == end) {
+        continue;
+      }
+      if (!result->empty() && result->back().end == segments + begin) {
+        result->back().end = segments + end;
+      } else {
+        result->push_back(SegmentSpan(segments + begin, segments + end));
+      }
+    }
+  }
+}
+
+unsigned RegularGrid::StartQuery() const {
+  if (++queryStamp_ == 0) {
+    std::fill(rectangleObjectStamps_.begin(), rectangleObjectStamps_.end(), 0);
+    std::fill(boundaryLineStamps_.begin(), boundaryLineStamps_.end(), 0);
+    queryStamp_ = 1;
+  }
+  return queryStamp_;
+}
+
+const Segment* RegularGrid::GetIntersectedSegment(
+    const Polygon& polygon, const std::vector<SegmentSpan>& spans) const {
+  for (unsigned index = 0; index < spans.size(); ++index) {
+    int begin = spans[index].begin - &segments_[0];
+    int end = spans[index].end - &segments_[0];
+    int intersected = FindFirstIntersectedSegment(
+        polygon, segmentArrays_, begin, end);
+    if (intersected != -1) {
+      return &segments_[intersected];
+    }
+  }
+  return NULL;
+}
+
+size_t RegularGrid::GetMemoryUsage() const {
+  size_t usage = sizeof(*this) +
+      grid_.capacity() * sizeof(std::vector<GridElement>);
+  for (size_t i = 0; i < grid_.size(); ++i) {
+    for (size_t j = 0; j < grid_[i].size(); ++j) {
+      usage += grid_[i][j].GetMemoryUsage();
+    }
+  }
+  usage += rectangleObjects_.capacity() * sizeof(const RectangleObject*);
+  usage += boundaryLines_.capacity() * sizeof(const BoundaryLine*);
+  usage += (rectangleObjectStamps_.capacity() +
+      boundaryLineStamps_.capacity()) * sizeof(unsigned);
+  usage += segments_.capacity() * sizeof(Segment);
+  usage += segmentArrays_.GetMemoryUsage();
+  usage += (cellBegin_.capacity() + originatingEnd_.capacity()) * sizeof(int);
+  return usage;
+}
+
+void RegularGrid::GetCellCoordinates(double x, double y,
+    int& i, int& j) const {
+  i = static_cast<int>(((x - minx_) * verticalCells_) / (maxx_ - minx_));
+  if (i >= verticalCells_) {
+    i = verticalCells_ - 1;
+  }
+  if (i < 0) {
+    i = 0;
+  }
+  j = static_cast<int>(((y - miny_) * horizontalCells_) / (maxy_ - miny_));
+  if (j >= horizontalCells_) {
+    j = horizontalCells_ - 1;
+  }
+  if (j < 0) {
+    j = 0;
+  }
+}
+
+}  // namespace geometry
@@ -1,55 +1,137 @@
-#ifndef CAR_SIMULATION_CAR_SIMULATION_HANDLERS_REGULAR_GRID_H_
-#define CAR_SIMULATION_CAR_SIMULATION_HANDLERS_REGULAR_GRID_H_
-
-#include <vector>
-
-namespace geometry {
-
-class BoundingBox;
-class BoundaryLine;
-class RectangleObject;
-
-class GridElement {
- public:
-  void AddRectangleObject(const RectangleObject* rectangle_object);
-  void AddBoundaryLine(const BoundaryLine* boundary_line);
-  void AddOriginatingBoundaryLine(const BoundaryLine* boundary_line);
-  void RemoveBoundaryLine(const BoundaryLine* boundary_line);
-
-  const std::vector<const RectangleObject*>& GetRectangleObjects() const;
-  const std::vector<const BoundaryLine*>& GetAllBoudnaryLines() const;
-  const std::vector<const BoundaryLine*>& GetOriginatingBoudnaryLines() const;
-
- private:
-  std::vector<const RectangleObject*> rectangleObjects_;
-  std::vector<const BoundaryLine*> allBoundaryLines_;
-  std::vector<const BoundaryLine*> originatingBoundaryLines_;
-};
-
-class RegularGrid {
- public:
-  RegularGrid(double minx, double maxx, double miny, double maxy);
-  void AddRectangleObject(const RectangleObject* object);  
-  void AddBoundaryLine(const BoundaryLine* border);
-  void RemoveBoundaryLine(const BoundaryLine* border);
-
-  std::vector<const RectangleObject*> GetRectangleObjects(
-      const BoundingBox& bounding_box) const;
-  std::vector<const RectangleObject*> GetRectangleObjects() const;
-
-  void GetBoundaryLines(const BoundingBox& bounding_box,
-                        std::vector<const BoundaryLine*>* result) const;
-  void GetBoundaryLines(std::vector<const BoundaryLine*>* result) const;
-  
- private:
-  void GetCellCoordinates(double x, double y, int& i, int& j) const;
-
- private:
-  std::vector<std::vector<GridElement> > grid_;
-  double minx_, maxx_;
-  double miny_, maxy_;
-};
-
-}  // namespace geometry
-
-#endif  // CAR_SIMULATION_CAR_SIMULATION_HANDLERS_REGULAR_GRID_H_
+#ifndef CAR_SIMULATION_CAR_SIMULATION_HANDLERS_REGULAR_GRID_H_
+#define CAR_SIMULATION_CAR_SIMULATION_HANDLERS_REGULAR_GRID_H_
+
+#include "geometry/segment.h"
+#include "geometry/segment_arrays.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace geometry {
+
+class BoundingBox;
+class BoundaryLine;
+class Polygon;
+class RectangleObject;
+
+// A run of segments stored next to each other in memory.
+struct SegmentSpan {
+  SegmentSpan(const Segment* span_begin, const Segment* span_end)
+    : begin(span_begin), end(span_end) {}
+
+  const Segment* begin;
+  const Segment* end;
+};
+
+// The contents of a grid cell. Objects and boundary lines are stored as
+// indices to the tables of the RegularGrid owning the cell.
+class GridElement {
+ public:
+  void AddRectangleObject(int rectangle_object);
+  void AddBoundaryLine(int boundary_line);
+  void AddOriginatingBoundaryLine(int boundary_line);
+  void RemoveBoundaryLine(int boundary_line);
+
+  const std::vector<int>& GetRectangleObjects() const;
+  const std::vector<int>& GetAllBoudnaryLines() const;
+  const std::vector<int>& GetOriginatingBoudnaryLines() const;
+
+  // The number of bytes allocated for the cell.
+  size_t GetMemoryUsage() const;
+
+ private:
+  std::vector<int> rectangleObjects_;
+  std::vector<int> allBoundaryLines_;
+  std::vector<int> originatingBoundaryLines_;
+};
+
+// GetRectangleObjects and GetBoundaryLines report every object and boundary
+// line once, even if it spans several of the visited cells. Duplicates are
+// skipped by stamping each reported item with the number of the query, so
+// the queries neither sort nor allocate. As the stamps are kept in the grid
+// these two queries should not be called concurrently, unlike
+// GetBoundarySegments.
+class RegularGrid {
+ public:
+  // Creates a grid with the default number of cells.
+  RegularGrid(double minx, double maxx, double miny, double maxy);
+
+  // Removes everything from the grid and splits the given area into
+  // vertical_cells x horizontal_cells cells.
+  void Reset(double minx, double maxx, double miny, double maxy,
+             int vertical_cells, int horizontal_cells);
+
+  int GetNumberOfVerticalCells() const;
+  int GetNumberOfHorizontalCells() const;
+  void AddRectangleObject(const RectangleObject* object);  
+  void AddBoundaryLine(const BoundaryLine* border);
+  void RemoveBoundaryLine(const BoundaryLine* border);
+
+  std::vector<const RectangleObject*> GetRectangleObjects(
+      const BoundingBox& bounding_box) const;
+  std::vector<const RectangleObject*> GetRectangleObjects() const;
+  void GetRectangleObjects(const BoundingBox& bounding_box,
+                           std::vector<const RectangleObject*>* result) const;
+
+  void GetBoundaryLines(const BoundingBox& bounding_box,
+                        std::vector<const BoundaryLine*>* result) const;
+  void GetBoundaryLines(std::vector<const BoundaryLine*>* result) const;
+
+  // Copies the segments of the straight boundary lines of every cell to a
+  // single array, the originating ones of each cell first. Should be called
+  // again after the boundary lines change.
+  void BuildSegmentIndex();
+
+  // Fills "result" with the segments of the boundary lines GetBoundaryLines
+  // would return for "bounding_box". A segment may be reported more than
+  // once. Cells whose segments follow each other in the index are merged
+  // into one span. Requires BuildSegmentIndex.
+  void GetBoundarySegments(const BoundingBox& bounding_box,
+                           std::vector<SegmentSpan>* result) const;
+
+  // Returns the first segment of "spans" intersecting "polygon" or NULL. The
+  // spans should be returned by GetBoundarySegments. The segments are tested
+  // in batches by FindFirstIntersectedSegment.
+  const Segment* GetIntersectedSegment(
+      const Polygon& polygon, const std::vector<SegmentSpan>& spans) const;
+
+  // The number of bytes allocated for the cells, the tables and the segment
+  // index of the grid.
+  size_t GetMemoryUsage() const;
+
+ private:
+  void GetCellCoordinates(double x, double y, int& i, int& j) const;
+
+  // Starts a new query and returns its stamp, clearing all the stamps when
+  // the counter wraps around.
+  unsigned StartQuery() const;
+
+ private:
+  std::vector<std::vector<GridElement> > grid_;
+
+  // Everything ever added to the grid. The cells refer to these tables.
+  std::vector<const RectangleObject*> rectangleObjects_;
+  std::vector<const BoundaryLine*> boundaryLines_;
+
+  // The stamp of the last query which reported each object and line.
+  mutable unsigned queryStamp_;
+  mutable std::vector<unsigned> rectangleObjectStamps_;
+  mutable std::vector<unsigned> boundaryLineStamps_;
+
+  // The segments of cell (i, j) are in the interval [cellBegin_[c],
+  // cellBegin_[c + 1]) where c = i * horizontalCells_ + j, and the
+  // originating ones in [cellBegin_[c], originatingEnd_[c]). The same
+  // segments are kept as coordinate arrays for the batched tests.
+  std::vector<Segment> segments_;
+  SegmentArrays segmentArrays_;
+  std::vector<int> cellBegin_;
+  std::vector<int> originatingEnd_;
+
+  double minx_, maxx_;
+  double miny_, maxy_;
+  int verticalCells_, horizontalCells_;
+};
+
+}  // namespace geometry
+
+#endif  // CAR_SIMULATION_CAR_SIMULATION_HANDLERS_REGULAR_GRID_H_
@@ -1,497 +1,654 @@
-#include "simulation/car_movement_handler.h"
-
-#include "geometry/arc.h"
-#include "geometry/bounding_box.h"
-#include "geometry/boundary_line.h"
-#include "geometry/geometry_utils.h"
-#include "geometry/line.h"
-#include "geometry/polygon.h"
-#include "geometry/segment.h"
-#include "geometry/rectangle_object.h"
-#include "geometry/straight_boundary_line.h"
-#include "geometry/vector.h"
-#include "simulation/car.h"
-#include "simulation/car_manuever.h"
-#include "utils/car_positions_graph_builder.h"
-#include "utils/benchmark.h"
-#include "utils/current_state.h"
-#include "utils/double_utils.h"
-#include "utils/intersection_handler.h"
-
-#include <cmath>
-#include <stdexcept>
-#include <string>
-
-namespace simulation {
-
-bool IntersectsSectionBetweenConcentricArcs(
-    const geometry::Arc& arc1, const geometry::Arc& arc2,
-    const std::vector<geometry::Segment>& segments);
-
-bool IntersectsSectionBetweenConcentricArcs(
-    const geometry::Arc& arc1, const geometry::Arc& arc2,
-    const geometry::Segment& segment);
-
-bool SectionBetweenConcentricArcsContains(
-    const geometry::Arc& arc1, const geometry::Arc& arc2,
-    const geometry::Point& point);
-
-CarMovementHandler::CarMovementHandler(
-    const utils::IntersectionHandler* intersection_handler,
-    const CarDescription &car_description)
-    : intersectionHandler_(intersection_handler),
-     carDescription_(car_description) {}
-
-const utils::IntersectionHandler* 
-    CarMovementHandler::GetIntersectionHandler() const {
-  return intersectionHandler_;
-}
-
-const CarDescription &CarMovementHandler::GetCarDescription() const {
-  return carDescription_;
-}
-
-// static
-bool CarMovementHandler::CarMovementPossibleByDistance(
-    const Car& car, double distance) const {
-  if (!DoubleIsZero(car.GetCurrentSteeringAngle())) {
-    geometry::Point rotation_center = car.GetRotationCenter();
-    geometry::Point center = car.GetPosition().GetCenter();
-    double radius = rotation_center.GetDistance(center);
-
-    double angle = distance / radius;
-    return CarMovementPossibleByAngle(car, angle);
-  } else {
-    return CarMovementPossibleByDistance(car.GetPosition(), distance);
-  }
-}
-
-// static
-bool CarMovementHandler::CarMovementPossibleByDistance(
-    const CarPosition& car_position, double distance) const {
-  geometry::Vector direction = car_position.GetDirection().Unit();
-
-  geometry::Point from = car_position.GetCenter() -
-      direction * carDescription_.GetLength() * 0.5;
-  geometry::Point to = from +
-      direction * (distance + carDescription_.GetLength());
-  geometry::RectangleObject ro(from, to, carDescription_.GetWidth());
-
-  geometry::Polygon bounds = ro.GetBounds();
-
-  for (unsigned i = 0; i < intersectedCache_.size(); ++i) {
-    if (geometry::Intersect(bounds, intersectedCache_[i], NULL)) {
-      return false;
-    }
-  }
-
-  geometry::BoundingBox bounding_box = ro.GetBoundingBox();
-  BENCHMARK_STR("place4");
-  std::vector<const geometry::BoundaryLine*> lines;
-  {
-      BENCHMARK_STR("getting the lines");
-      intersectionHandler_->GetBoundaryLines(bounding_box, &lines);
-  }
-  BENCHMARK_STR("place11");
-
-  BENCHMARK_STR("place3");
-  for (unsigned index = 0; index < lines.size(); ++index) {
-    const geometry::StraightBoundaryLine* line =
-        dynamic_cast<const geometry::StraightBoundaryLine*>(lines[index]);
-    if (geometry::Intersect(bounds, line->GetSegment(), NULL)) {
-      intersectedCache_.clear();
-      intersectedCache_.push_back(line->GetSegment());
-      return false;
-    }
-  }
-  return true;
-}
-
-bool CarMovementHandler::CarMovementPossibleByAngle(
-    const Car& car, double angle) const {
-  if (DoubleIsZero(car.GetCurrentSteeringAngle())) {
-    return true;
-  }
-
-  return CarMovementPossibleByAngle(car.GetPosition(), angle,
-      car.GetRotationCenter());
-}
-
-bool CarMovementHandler::CarMovementPossibleByAngle(
-    const CarPosition &car_position, double angle,
-    const geometry::Point &rotation_center) const {
-  if (DoubleIsGreater(angle, geometry::GeometryUtils::PI * 2.0)) {
-    angle = geometry::GeometryUtils::PI * 2.0;
-  }
-
-  geometry::BoundingBox bounding_box;
-  BENCHMARK_SCOPE;
-  geometry::Polygon start_position_bounds, end_position_bounds;
-  carDescription_.GetBounds(car_position, start_position_bounds);
-
-  std::vector<const geometry::BoundaryLine*> start_position_lines;
-  intersectionHandler_->GetBoundaryLines(
-      start_position_bounds.GetBoundingBox(), &start_position_lines);
-  for (unsigned index = 0; index < start_position_lines.size(); ++index) {
-    const geometry::StraightBoundaryLine* line = dynamic_cast<
-        const geometry::StraightBoundaryLine*>(start_position_lines[index]);
-    if (geometry::Intersect(start_position_bounds, line->GetSegment(), NULL)) {
-      return false;
-    }
-  }
-
-  CarPosition end_position;
-  end_position.SetDirection(car_position.GetDirection().Rotate(angle));
-  end_position.SetCenter(car_position.GetCenter().
-                         Rotate(rotation_center, angle));
-  carDescription_.GetBounds(end_position, end_position_bounds);
-
-  std::vector<const geometry::BoundaryLine*> end_position_lines;
-  intersectionHandler_->GetBoundaryLines(
-      end_position_bounds.GetBoundingBox(), &end_position_lines);
-  for (unsigned index = 0; index < end_position_lines.size(); ++index) {
-    const geometry::StraightBoundaryLine* line = dynamic_cast<
-        const geometry::StraightBoundaryLine*>(end_position_lines[index]);
-    if (geometry::Intersect(end_position_bounds, line->GetSegment(), NULL)) {
-      return false;
-    }
-  }
-
-  geometry::Vector direction = car_position.GetDirection();
-  std::vector<geometry::Arc> arcs;
-  std::vector<geometry::Point> points;
-
-  geometry::Point rlw = carDescription_.GetRearLeftWheelCenter(car_position);
-  geometry::Point rrw = carDescription_.GetRearRightWheelCenter(car_position);
-  geometry::Point rw_center;
-  if (DoubleIsGreater(rotation_center.GetDistance(rlw),
-      rotation_center.GetDistance(rrw))) {
-    rw_center = rrw;
-  } else {
-    rw_center = rlw;
-  }
-
-  geometry::Point opposite = start_position_bounds.GetPoint(0);
-  for (unsigned index = 1; index < start_position_bounds.NumberOfVertices(); ++index) {
-    geometry::Point temp = start_position_bounds.GetPoint(index);
-    if (DoubleIsGreater(temp.GetSquaredDistance(rw_center),
-        opposite.GetSquaredDistance(rw_center))){
-      opposite = temp;
-    }
-  }
-  points.push_back(rw_center);
-  points.push_back(opposite);
-
-  for (unsigned index = 0; index < points.size(); ++index) {
-    const geometry::Point& point = points[index];
-    geometry::Vector temp(rotation_center, point);
-    double actual_angle = angle;
-    if (DoubleIsGreater(0, temp.CrossProduct(direction)) &&
-        DoubleIsGreater(actual_angle, 0)) {
-      actual_angle = -actual_angle;
-    }
-    arcs.push_back(geometry::Arc(rotation_center, point, actual_angle));
-    bounding_box.UnionWith(arcs[index].GetBoundingBox());
-  }
-
-  BENCHMARK_SCOPE;
-  std::vector<const geometry::BoundaryLine*> lines;
-  intersectionHandler_->GetBoundaryLines(bounding_box, &lines);
-  BENCHMARK_SCOPE;
-  std::vector<geometry::Segment> segments(lines.size());
-  {
-    BENCHMARK_SCOPE;
-    for (unsigned index = 0 ; index < lines.size(); ++index) {
-      BENCHMARK_SCOPE;
-      const geometry::StraightBoundaryLine* line =
-          dynamic_cast<const geometry::StraightBoundaryLine*>(lines[index]);
-      segments[index] = line->GetSegment();
-    }
-  }
-  BENCHMARK_SCOPE;
-
-  for (unsigned index1 = 0; index1 < arcs.size(); ++index1) {
-    for (unsigned index2 = index1 + 1; index2 < arcs.size(); ++index2) {
-      if (IntersectsSectionBetweenConcentricArcs(arcs[index1], arcs[index2],
-          segments)) {
-        return false;
-      }
-    }
-  }
-
-  return true;
-}
-
-
-bool IntersectsSectionBetweenConcentricArcs(
-      const geometry::Arc& arc1, const geometry::Arc& arc2,
-      const std::vector<geometry::Segment>& segments) {
-  for (unsigned index = 0; index < segments.size(); ++index) {
-    if (IntersectsSectionBetweenConcentricArcs(arc1, arc2, segments[index])) {
-      return true;
-    }
-  }
-  return false;
-}
-
-bool IntersectsSectionBetweenConcentricArcs(
-      const geometry::Arc& arc1, const geometry::Arc& arc2,
-      const geometry::Segment& segment) {
-  BENCHMARK_SCOPE;
-  const geometry::Point& from1 = arc1.GetStartPoint();
-  const geometry::Point& to1 = arc1.GetEndPoint();
-
-  const geometry::Point& from2 = arc2.GetStartPoint();
-  const geometry::Point& to2 = arc2.GetEndPoint();
-
-  geometry::Segment from_segment(from1, from2);
-  geometry::Segment to_segment(to1, to2);
-
-  if (from_segment.Intersect(segment)) {
-    return true;
-  }
-
-  if (to_segment.Intersect(segment)) {
-    return true;
-  }
-
-  BENCHMARK_SCOPE;
-  if (arc1.IntersectFast(segment)) {
-    return true;
-  }
-
-  if (arc2.IntersectFast(segment)) {
-    return true;
-  }
-  BENCHMARK_SCOPE;
-  if (SectionBetweenConcentricArcsContains(arc1, arc2, segment.A()) && 
-      SectionBetweenConcentricArcsContains(arc1, arc2, segment.B())) {
-    return true;
-  }
-
-  return false;
-}
-
-bool SectionBetweenConcentricArcsContains(
-    const geometry::Arc& arc1, const geometry::Arc& arc2,
-    const geometry::Point& point) {
-  BENCHMARK_STR("begin");
-  geometry::Point center = arc1.GetCenter();
-  if (center != arc2.GetCenter()) {
-    throw std::invalid_argument("The arcs are not concentric!");
-  }
-
-  double r1 = arc1.GetRadius();
-  double r2 = arc2.GetRadius();
-
-  double distance = center.GetDistance(point);
-  if (!DoubleIsBetween(distance, r1, r2)) {
-    return false;
-  }
-  BENCHMARK_STR("after distance check");
-  const double pi = geometry::GeometryUtils::PI;
-
-  double start1 = arc1.GetStartAngle();
-  double end1 = arc1.GetEndAngle();
-  if (DoubleIsGreater(start1, end1)) {
-    end1 += pi * 2.0;
-  }
-  double start2 = arc2.GetStartAngle();
-  double end2 = arc2.GetEndAngle();
-  if (DoubleIsGreater(start2, end2)) {
-    end2 += pi * 2.0;
-  }
-
-  double begin_angle = std::max(start1, start2);
-  double end_angle = std::min(end1, end2);
-  if (DoubleIsGreaterOrEqual(begin_angle, end_angle)) {
-    return false;
-  }
-  BENCHMARK_STR("after angle check");
-  double angle = atan2(point.y - center.y, point.x - center.x);
-  angle = geometry::GeometryUtils::NormalizeAngle(angle);
-
-  // Check if the point is within the common interval of angles for 
-  // the two arcs.
-  if (DoubleIsBetween(angle, begin_angle, end_angle) ||
-      DoubleIsBetween(angle + 2.0 * pi, begin_angle, end_angle)) {
-    return true;
-  }
-
-  // Check if the triangle in the begining of the two arcs contains the point.
-  geometry::Point A1 = arc1.GetStartPoint();
-  geometry::Point B1 = arc2.GetStartPoint();
-  geometry::Point C1;
-  if (DoubleIsGreater(start1, start2)) {
-    C1 = arc2.GetCircle().GetPoint(start1);
-  } else {
-    C1 = arc1.GetCircle().GetPoint(start2);
-  }
-
-  if (geometry::GeometryUtils::TriangleContains(A1, B1, C1, point)) {
-    return true;
-  }
-    BENCHMARK_STR("after first triangle check");
-  // Check if the triangle at the end of the two arcs contains the point.
-  geometry::Point A2 = arc1.GetEndPoint();
-  geometry::Point B2 = arc2.GetEndPoint();
-  geometry::Point C2;
-  if (DoubleIsGreater(end1, end2)) {
-    C2 = arc1.GetCircle().GetPoint(end2);
-  } else {
-    C2 = arc2.GetCircle().GetPoint(end1);
-  }
-
-  if (geometry::GeometryUtils::TriangleContains(A2, B2, C2, point)) {
-    return true;
-  }
-  return false;
-}
-
-static const double ROTATION_RADIUS_LIMIT = 2000;
-
-// static
-bool CarMovementHandler::SingleManueverBetweenStates(
-        const CarPosition& car1, const CarPosition& car2,
-        CarManuever& manuever) const {
-  BENCHMARK_SCOPE;
-  const geometry::Vector& dir1 = car1.GetDirection();
-  const geometry::Vector& dir2 = car2.GetDirection();
-
-  const geometry::Point& center1 = car1.GetCenter();
-  const geometry::Point& center2 = car2.GetCenter();
-  BENCHMARK_SCOPE;
-  if (DoubleIsZero(dir1.CrossProduct(dir2))) {
-    geometry::Vector vector(center1, center2);
-    BENCHMARK_STR("Case 1");
-    
-    // All four points lie on the same line
-    if (DoubleIsZero(vector.CrossProduct(dir1))) {
-      // Opposite directions - no solution
-      if (DoubleIsGreaterOrEqual(0, dir1.DotProduct(dir2))) {
-        return false;
-      }
-      if (DoubleIsGreaterOrEqual(0, vector.DotProduct(dir2))) {
-        return false;
-      }
-      double temp_distance = center1.GetDistance(center2);
-      if (car2.IsAlongBaseLine() && DoubleIsGreater(temp_distance, 
-          utils::CarPositionsGraphBuilder::GetSamplingStep())) {
-        return false;
-      }
-      if (!CarMovementPossibleByDistance(car1, temp_distance)) {
-          return false;
-      } else {
-          manuever.SetBeginPosition(car1);
-          manuever.SetInitialStraightSectionDistance(temp_distance);
-          return true;
-      }
-    }
-
-    // Same direction - no solution
-    if (DoubleIsGreaterOrEqual(dir1.DotProduct(dir2), 0)) {
-      return false;
-    }
-
-    geometry::Segment central(center1, center2);
-    geometry::Line l = central.GetSimmetral();
-    geometry::Point rotation_center;
-    l.Intersect(carDescription_.GetRearWheelsAxis(car1), &rotation_center);
-    return ConstructManuever(car1, car2, rotation_center, manuever);
-  }
-  BENCHMARK_STR("Case 2");
-  geometry::Line l1(center1, dir1);
-  geometry::Line l2(center2, dir2);
-
-  // Avoid the case when center1 or center2 is the intersection
-  if (DoubleIsZero(l1.GetDistanceFromPoint(center2)) ||
-      DoubleIsZero(l2.GetDistanceFromPoint(center1))) {
-    return false;
-  }
-
-  geometry::Point intersection;
-  l1.Intersect(l2, &intersection);
-  if (DoubleIsGreater(
-      geometry::Vector(intersection, center1).DotProduct(dir1), 0)) {
-      return false;
-  }
-
-  geometry::Line bisectrics = geometry::GeometryUtils::GetBisectrice(
-        intersection - dir1, intersection, intersection + dir2);
-
-  geometry::Point rotation_center;
-  bisectrics.Intersect(carDescription_.GetRearWheelsAxis(car1),
-      &rotation_center);
-  BENCHMARK_STR("After intersection");
-  if (DoubleIsGreater(rotation_center.GetDistance(center1),
-                      ROTATION_RADIUS_LIMIT)) {
-    return false;
-  }
-
-  BENCHMARK_STR("After the centers");
-  return ConstructManuever(car1, car2, rotation_center, manuever);
-}
-
-bool CarMovementHandler::ConstructManuever(
-    const CarPosition &car1, const CarPosition &car2,
-    const geometry::Point &rotation_center,
-    CarManuever &manuever) const {
-  BENCHMARK_SCOPE;
-  if (!carDescription_.CanBeRotationCenter(car1, rotation_center)) {
-    return false;
-  }
-
-  const geometry::Point& center1 = car1.GetCenter();
-  const geometry::Point& center2 = car2.GetCenter();
-  const geometry::Vector& dir2 = car2.GetDirection();
-  const geometry::Vector& dir1 = car1.GetDirection();
-
-  BENCHMARK_STR("Case 1");
-
-  double angle = geometry::GeometryUtils::GetAngleBetweenVectors(
-        dir1, dir2);
- 
-  geometry::Point center = center1.Rotate(rotation_center, angle);
-  geometry::Vector vec(center, center2);
-  
-  if (DoubleIsGreaterOrEqual(0, vec.DotProduct(dir2))) {
-    return false;
-  }
-
-  BENCHMARK_STR("Case 3");
-
-  double distance = center.GetDistance(center2);
-  if (car2.IsAlongBaseLine() && DoubleIsGreater(distance, 
-      utils::CarPositionsGraphBuilder::GetSamplingStep())) {
-    return false;
-  }
-
-  BENCHMARK_STR("Case 4");
-  CarPosition after_turn = car1;
-  after_turn.SetDirection(dir2);
-  after_turn.SetCenter(center);
-
-  if (!CarMovementPossibleByDistance(after_turn, distance)) {
-    return false;
-  }
-
-  BENCHMARK_STR("Case 2");
-
-  const double pi = geometry::GeometryUtils::PI;
-  if (DoubleIsGreater(angle, pi)) {
-    angle = angle - 2.0 * pi;
-  }
-
-  if (!CarMovementPossibleByAngle(car1, angle, rotation_center)) {
-    return false;
-  }
-
-  BENCHMARK_STR("Manuever constructed");
-  manuever.SetBeginPosition(car1);
-  manuever.SetTurnAngle(angle);
-  manuever.SetRotationCenter(rotation_center);
-  manuever.SetFinalStraightSectionDistance(distance);
-  return true;
-}
-
-}  // namespace simulation
+#include "simulation/car_movement_handler.h"
+
+#include "geometry/arc.h"
+#include "geometry/bounding_box.h"
+#include "geometry/geometry_utils.h"
+#include "geometry/line.h"
+#include "geometry/polygon.h"
+#include "geometry/segment.h"
+#include "geometry/rectangle_object.h"
+#include "geometry/vector.h"
+#include "simulation/car.h"
+#include "simulation/car_manuever.h"
+#include "utils/car_positions_graph_builder.h"
+#include "utils/benchmark.h"
+#include "utils/current_state.h"
+#include "utils/double_utils.h"
+#include "utils/intersection_handler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+namespace simulation {
+
+bool IntersectsSectionBetweenConcentricArcs(
+    const geometry::Arc& arc1, const geometry::Arc& arc2,
+    const std::vector<geometry::SegmentSpan>& spans);
+
+bool IntersectsSectionBetweenConcentricArcs(
+    const geometry::Arc& arc1, const geometry::Arc& arc2,
+    const geometry::Segment& segment);
+
+bool SectionBetweenConcentricArcsContains(
+    const geometry::Arc& arc1, const geometry::Arc& arc2,
+    const geometry::Point& point);
+
+void GetSectionTriangleApexes(
+    const geometry::Arc& arc1, const geometry::Arc& arc2,
+    geometry::Point* begin_apex, geometry::Point* end_apex);
+
+// Bounds of the region checked by IntersectsSectionBetweenConcentricArcs:
+// its bounding box and the interval of distances from the common center of
+// the arcs. The bounds are conservative, so a segment outside them cannot
+// intersect the region and the exact test may be skipped.
+struct SectionBounds {
+  geometry::Point center;
+  double minX, maxX, minY, maxY;
+  double minSquaredDistance, maxSquaredDistance;
+};
+
+void GetSectionBounds(const geometry::Arc& arc1, const geometry::Arc& arc2,
+                      SectionBounds* bounds);
+
+bool SectionBoundsExclude(const SectionBounds& bounds,
+                          const geometry::Segment& segment);
+
+CarMovementHandler::CarMovementHandler(
+    const utils::IntersectionHandler* intersection_handler,
+    const CarDescription &car_description)
+    : intersectionHandler_(intersection_handler),
+     carDescription_(car_description),
+     collisionCache_(new CollisionCache()) {}
+
+const utils::IntersectionHandler* 
+    CarMovementHandler::GetIntersectionHandler() const {
+  return intersectionHandler_;
+}
+
+const CarDescription &CarMovementHandler::GetCarDescription() const {
+  return carDescription_;
+}
+
+const CollisionCache& CarMovementHandler::GetCollisionCache() const {
+  return *collisionCache_;
+}
+
+// static
+bool CarMovementHandler::CarMovementPossibleByDistance(
+    const Car& car, double distance, CarMovementContext* context) const {
+  if (!DoubleIsZero(car.GetCurrentSteeringAngle())) {
+    geometry::Point rotation_center = car.GetRotationCenter();
+    geometry::Point center = car.GetPosition().GetCenter();
+    double radius = rotation_center.GetDistance(center);
+
+    double angle = distance / radius;
+    return CarMovementPossibleByAngle(car, angle, context);
+  } else {
+    return CarMovementPossibleByDistance(car.GetPosition(), distance,
+                                         context);
+  }
+}
+
+// static
+bool CarMovementHandler::CarMovementPossibleByDistance(
+    const CarPosition& car_position, double distance,
+    CarMovementContext* context) const {
+  if (intersectionHandler_ == NULL) {
+    return true;
+  }
+  geometry::Vector direction = car_position.GetDirection().Unit();
+
+  geometry::Point from = car_position.GetCenter() -
+      direction * carDescription_.GetLength() * 0.5;
+  geometry::Point to = from +
+      direction * (distance + carDescription_.GetLength());
+  geometry::RectangleObject ro(from, to, carDescription_.GetWidth());
+
+  geometry::Polygon& bounds = context->bounds;
+  ro.GetBounds(&bounds);
+
+  unsigned long long key = CollisionCache::GetKey(car_position);
+  geometry::Segment cached;
+  if (collisionCache_->Lookup(key, &cached) &&
+      geometry::Intersect(bounds, cached, NULL)) {
+    collisionCache_->RecordHit();
+    return false;
+  }
+  collisionCache_->RecordMiss();
+
+  BENCHMARK_STR("place3");
+  const geometry::Segment* segment =
+      intersectionHandler_->GetIntersectedBoundarySegment(
+          bounds, &context->spans);
+  if (segment != NULL) {
+    collisionCache_->Insert(key, *segment);
+    return false;
+  }
+  return true;
+}
+
+bool CarMovementHandler::CarMovementPossibleByAngle(
+    const Car& car, double angle, CarMovementContext* context) const {
+  if (DoubleIsZero(car.GetCurrentSteeringAngle())) {
+    return true;
+  }
+
+  return CarMovementPossibleByAngle(car.GetPosition(), angle,
+      car.GetRotationCenter(), context);
+}
+
+bool CarMovementHandler::CarMovementPossibleByAngle(
+    const CarPosition &car_position, double angle,
+    const geometry::Point &rotation_center,
+    CarMovementContext* context) const {
+  if (intersectionHandler_ == NULL) {
+    return true;
+  }
+  if (DoubleIsGreater(angle, geometry::GeometryUtils::PI * 2.0)) {
+    angle = geometry::GeometryUtils::PI * 2.0;
+  }
+
+  geometry::BoundingBox bounding_box;
+  BENCHMARK_SCOPE;
+  geometry::Polygon& start_position_bounds = context->bounds;
+  geometry::Polygon& end_position_bounds = context->endBounds;
+  carDescription_.GetBounds(car_position, start_position_bounds);
+
+  std::vector<geometry::SegmentSpan>& spans = context->spans;
+  if (intersectionHandler_->GetIntersectedBoundarySegment(
+      start_position_bounds, &spans) != NULL) {
+    return false;
+  }
+
+  CarPosition end_position;
+  end_position.SetDirection(car_position.GetDirection().Rotate(angle));
+  end_position.SetCenter(car_position.GetCenter().
+                         Rotate(rotation_center, angle));
+  carDescription_.GetBounds(end_position, end_position_bounds);
+
+  if (intersectionHandler_->GetIntersectedBoundarySegment(
+      end_position_bounds, &spans) != NULL) {
+    return false;
+  }
+
+  geometry::Vector direction = car_position.GetDirection();
+  std::vector<geometry::Arc>& arcs = context->arcs;
+  std::vector<geometry::Point>& points = context->points;
+  arcs.clear();
+  points.clear();
+
+  geometry::Point rlw = carDescription_.GetRearLeftWheelCenter(car_position);
+  geometry::Point rrw = carDescription_.GetRearRightWheelCenter(car_position);
+  geometry::Point rw_center;
+  if (DoubleIsGreater(rotation_center.GetDistance(rlw),
+      rotation_center.GetDistance(rrw))) {
+    rw_center = rrw;
+  } else {
+    rw_center = rlw;
+  }
+
+  geometry::Point opposite = start_position_bounds.GetPoint(0);
+  for (unsigned index = 1; index < start_position_bounds.NumberOfVertices(); ++index) {
+    geometry::Point temp = start_position_bounds.GetPoint(index);
+    if (DoubleIsGreater(temp.GetSquaredDistance(rw_center),
+        opposite.GetSquaredDistance(rw_center))){
+      opposite = temp;
+    }
+  }
+  points.push_back(rw_center);
+  points.push_back(opposite);
+
+  for (unsigned index = 0; index < points.size(); ++index) {
+    const geometry::Point& point = points[index];
+    geometry::Vector temp(rotation_center, point);
+    double actual_angle = angle;
+    if (DoubleIsGreater(0, temp.CrossProduct(direction)) &&
+        DoubleIsGreater(actual_angle, 0)) {
+      actual_angle = -actual_angle;
+    }
+    arcs.push_back(geometry::Arc(rotation_center, point, actual_angle));
+    bounding_box.UnionWith(arcs[index].GetBoundingBox());
+  }
+
+  BENCHMARK_SCOPE;
+  intersectionHandler_->GetBoundarySegments(bounding_box, &spans);
+  BENCHMARK_SCOPE;
+
+  for (unsigned index1 = 0; index1 < arcs.size(); ++index1) {
+    for (unsigned index2 = index1 + 1; index2 < arcs.size(); ++index2) {
+      if (IntersectsSectionBetweenConcentricArcs(arcs[index1], arcs[index2],
+          spans)) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+
+bool IntersectsSectionBetweenConcentricArcs(
+      const geometry::Arc& arc1, const geometry::Arc& arc2,
+      const std::vector<geometry::SegmentSpan>& spans) {
+  SectionBounds bounds;
+  GetSectionBounds(arc1, arc2, &bounds);
+  for (unsigned index = 0; index < spans.size(); ++index) {
+    for (const geometry::Segment* segment = spans[index].begin;
+         segment != spans[index].end; ++segment) {
+      BENCHMARK_COUNT("candidate segments");
+      if (SectionBoundsExclude(bounds, *segment)) {
+        BENCHMARK_COUNT("rejected segments");
+        continue;
+      }
+      if (IntersectsSectionBetweenConcentricArcs(arc1, arc2, *segment)) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+// Returns the squared distance from "point" to the segment AB.
+static double GetSquaredDistanceToSegment(const geometry::Point& point,
+    const geometry::Point& A, const geometry::Point& B) {
+  double dx = B.x - A.x;
+  double dy = B.y - A.y;
+  double squared_length = dx * dx + dy * dy;
+  double t = 0.0;
+  if (squared_length > 0.0) {
+    t = ((point.x - A.x) * dx + (point.y - A.y) * dy) / squared_length;
+    t = std::max(0.0, std::min(1.0, t));
+  }
+  double x = A.x + dx * t - point.x;
+  double y = A.y + dy * t - point.y;
+  return x * x + y * y;
+}
+
+// Returns the smallest distance from "point" to the triangle ABC.
+static double GetSquaredDistanceToTriangle(const geometry::Point& point,
+    const geometry::Point& A, const geometry::Point& B,
+    const geometry::Point& C) {
+  if (geometry::GeometryUtils::TriangleContains(A, B, C, point)) {
+    return 0.0;
+  }
+  return std::min(GetSquaredDistanceToSegment(point, A, B),
+      std::min(GetSquaredDistanceToSegment(point, B, C),
+               GetSquaredDistanceToSegment(point, C, A)));
+}
+
+// The margin added to the bounds so that they cover whatever the tolerant
+// comparisons of the exact test accept.
+static const double SECTION_BOUNDS_MARGIN = 1e-6;
+
+void GetSectionBounds(const geometry::Arc& arc1, const geometry::Arc& arc2,
+                      SectionBounds* bounds) {
+  // The region consists of the parts of the annulus between the arcs, the
+  // segments joining their ends and the triangles at both ends. The bounding
+  // boxes of the arcs contain their center and ends.
+  const geometry::Point& center = arc1.GetCircle().GetCenter();
+  geometry::Point begin_apex, end_apex;
+  GetSectionTriangleApexes(arc1, arc2, &begin_apex, &end_apex);
+
+  geometry::BoundingBox bounding_box = arc1.GetBoundingBox();
+  bounding_box.UnionWith(arc2.GetBoundingBox());
+  bounding_box.AddPoint(begin_apex);
+  bounding_box.AddPoint(end_apex);
+  bounds->center = center;
+  bounds->minX = bounding_box.GetMinX() - SECTION_BOUNDS_MARGIN;
+  bounds->maxX = bounding_box.GetMaxX() + SECTION_BOUNDS_MARGIN;
+  bounds->minY = bounding_box.GetMinY() - SECTION_BOUNDS_MARGIN;
+  bounds->maxY = bounding_box.GetMaxY() + SECTION_BOUNDS_MARGIN;
+
+  // Every part lies in the disc with the larger radius. The segments and the
+  // triangles may come closer to the center than the smaller radius.
+  double r1 = arc1.GetRadius();
+  double r2 = arc2.GetRadius();
+  double max_distance = std::max(r1, r2) + SECTION_BOUNDS_MARGIN;
+  double min_squared_distance = std::min(r1, r2) * std::min(r1, r2);
+  min_squared_distance = std::min(min_squared_distance,
+      GetSquaredDistanceToTriangle(center, arc1.GetStartPoint(),
+                                   arc2.GetStartPoint(), begin_apex));
+  min_squared_distance = std::min(min_squared_distance,
+      GetSquaredDistanceToTriangle(center, arc1.GetEndPoint(),
+                                   arc2.GetEndPoint(), end_apex));
+  double min_distance = std::max(
+      0.0, sqrt(min_squared_distance) - SECTION_BOUNDS_MARGIN);
+  bounds->minSquaredDistance = min_distance * min_distance;
+  bounds->maxSquaredDistance = max_distance * max_distance;
+}
+
+bool SectionBoundsExclude(const SectionBounds& bounds,
+                          const geometry::Segment& segment) {
+  const geometry::Point& A = segment.A();
+  const geometry::Point& B = segment.B();
+  if (std::min(A.x, B.x) > bounds.maxX || std::max(A.x, B.x) < bounds.minX ||
+      std::min(A.y, B.y) > bounds.maxY || std::max(A.y, B.y) < bounds.minY) {
+    return true;
+  }
+
+  // The distances from the center to the points of the segment form the
+  // interval [distance to the segment, distance to the farther end].
+  double ax = A.x - bounds.center.x;
+  double ay = A.y - bounds.center.y;
+  double bx = B.x - bounds.center.x;
+  double by = B.y - bounds.center.y;
+  if (std::max(ax * ax + ay * ay, bx * bx + by * by) <
+      bounds.minSquaredDistance) {
+    return true;
+  }
+  return GetSquaredDistanceToSegment(bounds.center, A, B) >
+      bounds.maxSquaredDistance;
+}
+
+bool IntersectsSectionBetweenConcentricArcs(
+      const geometry::Arc& arc1, const geometry::Arc& arc2,
+      const geometry::Segment& segment) {
+  BENCHMARK_SCOPE;
+  const geometry::Point& from1 = arc1.GetStartPoint();
+  const geometry::Point& to1 = arc1.GetEndPoint();
+
+  const geometry::Point& from2 = arc2.GetStartPoint();
+  const geometry::Point& to2 = arc2.GetEndPoint();
+
+  geometry::Segment from_segment(from1, from2);
+  geometry::Segment to_segment(to1, to2);
+
+  if (from_segment.Intersect(segment)) {
+    return true;
+  }
+
+  if (to_segment.Intersect(segment)) {
+    return true;
+  }
+
+  BENCHMARK_SCOPE;
+  if (arc1.IntersectFast(segment)) {
+    return true;
+  }
+
+  if (arc2.IntersectFast(segment)) {
+    return true;
+  }
+  BENCHMARK_SCOPE;
+  if (SectionBetweenConcentricArcsContains(arc1, arc2, segment.A()) && 
+      SectionBetweenConcentricArcsContains(arc1, arc2, segment.B())) {
+    return true;
+  }
+
+  return false;
+}
+
+bool SectionBetweenConcentricArcsContains(
+    const geometry::Arc& arc1, const geometry::Arc& arc2,
+    const geometry::Point& point) {
+  BENCHMARK_STR("begin");
+  geometry::Point center = arc1.GetCenter();
+  if (center != arc2.GetCenter()) {
+    throw std::invalid_argument("The arcs are not concentric!");
+  }
+
+  double r1 = arc1.GetRadius();
+  double r2 = arc2.GetRadius();
+
+  double distance = center.GetDistance(point);
+  if (!DoubleIsBetween(distance, r1, r2)) {
+    return false;
+  }
+  BENCHMARK_STR("after distance check");
+  const double pi = geometry::GeometryUtils::PI;
+
+  double start1 = arc1.GetStartAngle();
+  double end1 = arc1.GetEndAngle();
+  if (DoubleIsGreater(start1, end1)) {
+    end1 += pi * 2.0;
+  }
+  double start2 = arc2.GetStartAngle();
+  double end2 = arc2.GetEndAngle();
+  if (DoubleIsGreater(start2, end2)) {
+    end2 += pi * 2.0;
+  }
+
+  double begin_angle = std::max(start1, start2);
+  double end_angle = std::min(end1, end2);
+  if (DoubleIsGreaterOrEqual(begin_angle, end_angle)) {
+    return false;
+  }
+  BENCHMARK_STR("after angle check");
+  double angle = atan2(point.y - center.y, point.x - center.x);
+  angle = geometry::GeometryUtils::NormalizeAngle(angle);
+
+  // Check if the point is within the common interval of angles for 
+  // the two arcs.
+  if (DoubleIsBetween(angle, begin_angle, end_angle) ||
+      DoubleIsBetween(angle + 2.0 * pi, begin_angle, end_angle)) {
+    return true;
+  }
+
+  geometry::Point C1, C2;
+  GetSectionTriangleApexes(arc1, arc2, &C1, &C2);
+
+  // Check if the triangle in the begining of the two arcs contains the point.
+  geometry::Point A1 = arc1.GetStartPoint();
+  geometry::Point B1 = arc2.GetStartPoint();
+  if (geometry::GeometryUtils::TriangleContains(A1, B1, C1, point)) {
+    return true;
+  }
+    BENCHMARK_STR("after first triangle check");
+  // Check if the triangle at the end of the two arcs contains the point.
+  geometry::Point A2 = arc1.GetEndPoint();
+  geometry::Point B2 = arc2.GetEndPoint();
+  if (geometry::GeometryUtils::TriangleContains(A2, B2, C2, point)) {
+    return true;
+  }
+  return false;
+}
+
+// The triangles at the ends of the section have the start (end) points of
+// the two arcs as vertices and the point where the later starting (earlier
+// ending) arc begins (ends) projected on the other circle as the apex.
+void GetSectionTriangleApexes(
+    const geometry::Arc& arc1, const geometry::Arc& arc2,
+    geometry::Point* begin_apex, geometry::Point* end_apex) {
+  const double pi = geometry::GeometryUtils::PI;
+  double start1 = arc1.GetStartAngle();
+  double end1 = arc1.GetEndAngle();
+  if (DoubleIsGreater(start1, end1)) {
+    end1 += pi * 2.0;
+  }
+  double start2 = arc2.GetStartAngle();
+  double end2 = arc2.GetEndAngle();
+  if (DoubleIsGreater(start2, end2)) {
+    end2 += pi * 2.0;
+  }
+
+  if (DoubleIsGreater(start1, start2)) {
+    *begin_apex = arc2.GetCircle().GetPoint(start1);
+  } else {
+    *begin_apex = arc1.GetCircle().GetPoint(start2);
+  }
+  if (DoubleIsGreater(end1, end2)) {
+    *end_apex = arc1.GetCircle().GetPoint(end2);
+  } else {
+    *end_apex = arc2.GetCircle().GetPoint(end1);
+  }
+}
+
+static const double ROTATION_RADIUS_LIMIT = 2000;
+
+// static
+bool CarMovementHandler::SingleManueverBetweenStates(
+        const CarPosition& car1, const CarPosition& car2,
+        CarManuever& manuever, CarMovementContext* context) const {
+  BENCHMARK_SCOPE;
+  const geometry::Vector& dir1 = car1.GetDirection();
+  const geometry::Vector& dir2 = car2.GetDirection();
+
+  const geometry::Point& center1 = car1.GetCenter();
+  const geometry::Point& center2 = car2.GetCenter();
+  BENCHMARK_SCOPE;
+  if (DoubleIsZero(dir1.CrossProduct(dir2))) {
+    geometry::Vector vector(center1, center2);
+    BENCHMARK_STR("Case 1");
+    
+    // All four points lie on the same line
+    if (DoubleIsZero(vector.CrossProduct(dir1))) {
+      // Opposite directions - no solution
+      if (DoubleIsGreaterOrEqual(0, dir1.DotProduct(dir2))) {
+        return false;
+      }
+      if (DoubleIsGreaterOrEqual(0, vector.DotProduct(dir2))) {
+        return false;
+      }
+      double temp_distance = center1.GetDistance(center2);
+      if (car2.IsAlongBaseLine() && DoubleIsGreater(temp_distance, 
+          utils::CarPositionsGraphBuilder::GetSamplingStep())) {
+        return false;
+      }
+      if (!CarMovementPossibleByDistance(car1, temp_distance, context)) {
+          return false;
+      } else {
+          manuever.SetBeginPosition(car1);
+          manuever.SetInitialStraightSectionDistance(temp_distance);
+          return true;
+      }
+    }
+
+    // Same direction - no solution
+    if (DoubleIsGreaterOrEqual(dir1.DotProduct(dir2), 0)) {
+      return false;
+    }
+
+    geometry::Segment central(center1, center2);
+    geometry::Line l = central.GetSimmetral();
+    geometry::Point rotation_center;
+    l.Intersect(carDescription_.GetRearWheelsAxis(car1), &rotation_center);
+    return ConstructManuever(car1, car2, rotation_center, manuever, context);
+  }
+  BENCHMARK_STR("Case 2");
+  geometry::Line l1(center1, dir1);
+  geometry::Line l2(center2, dir2);
+
+  // Avoid the case when center1 or center2 is the intersection
+  if (DoubleIsZero(l1.GetDistanceFromPoint(center2)) ||
+      DoubleIsZero(l2.GetDistanceFromPoint(center1))) {
+    return false;
+  }
+
+  geometry::Point intersection;
+  l1.Intersect(l2, &intersection);
+  if (DoubleIsGreater(
+      geometry::Vector(intersection, center1).DotProduct(dir1), 0)) {
+      return false;
+  }
+
+  geometry::Line bisectrics = geometry::GeometryUtils::GetBisectrice(
+        intersection - dir1, intersection, intersection + dir2);
+
+  geometry::Point rotation_center;
+  bisectrics.Intersect(carDescription_.GetRearWheelsAxis(car1),
+      &rotation_center);
+  BENCHMARK_STR("After intersection");
+  if (DoubleIsGreater(rotation_center.GetDistance(center1),
+                      ROTATION_RADIUS_LIMIT)) {
+    return false;
+  }
+
+  BENCHMARK_STR("After the centers");
+  return ConstructManuever(car1, car2, rotation_center, manuever, context);
+}
+
+bool CarMovementHandler::ConstructManuever(
+    const CarPosition &car1, const CarPosition &car2,
+    const geometry::Point &rotation_center,
+    CarManuever &manuever, CarMovementContext* context) const {
+  BENCHMARK_SCOPE;
+  if (!carDescription_.CanBeRotationCenter(car1, rotation_center)) {
+    return false;
+  }
+
+  const geometry::Point& center1 = car1.GetCenter();
+  const geometry::Point& center2 = car2.GetCenter();
+  const geometry::Vector& dir2 = car2.GetDirection();
+  const geometry::Vector& dir1 = car1.GetDirection();
+
+  BENCHMARK_STR("Case 1");
+
+  double angle = geometry::GeometryUtils::GetAngleBetweenVectors(
+        dir1, dir2);
+ 
+  geometry::Point center = center1.Rotate(rotation_center, angle);
+  geometry::Vector vec(center, center2);
+  
+  if (DoubleIsGreaterOrEqual(0, vec.DotProduct(dir2))) {
+    return false;
+  }
+
+  BENCHMARK_STR("Case 3");
+
+  double distance = center.GetDistance(center2);
+  if (car2.IsAlongBaseLine() && DoubleIsGreater(distance, 
+      utils::CarPositionsGraphBuilder::GetSamplingStep())) {
+    return false;
+  }
+
+  BENCHMARK_STR("Case 4");
+  CarPosition after_turn = car1;
+  after_turn.SetDirection(dir2);
+  after_turn.SetCenter(center);
+
+  if (!CarMovementPossibleByDistance(after_turn, distance, context)) {
+    return false;
+  }
+
+  BENCHMARK_STR("Case 2");
+
+  const double pi = geometry::GeometryUtils::PI;
+  if (DoubleIsGreater(angle, pi)) {
+    angle = angle - 2.0 * pi;
+  }
+
+  if (!CarMovementPossibleByAngle(car1, angle, rotation_center, context)) {
+    return false;
+  }
+
+  BENCHMARK_STR("Manuever constructed");
+  manuever.SetBeginPosition(car1);
+  manuever.SetTurnAngle(angle);
+  manuever.SetRotationCenter(rotation_center);
+  manuever.SetFinalStraightSectionDistance(distance);
+  return true;
+}
+
+bool CarMovementHandler::ManueverPossible(
+    const CarManuever& manuever, const CarPosition& end_position,
+    CarMovementContext* context) const {
+  CarPosition begin_position = manuever.GetBeginPosition();
+  double sampling_step = utils::CarPositionsGraphBuilder::GetSamplingStep();
+  if (DoubleIsZero(manuever.GetTurnAngle())) {
+    double distance = manuever.GetInitialStraightSectionDistance();
+    if (end_position.IsAlongBaseLine() &&
+        DoubleIsGreater(distance, sampling_step)) {
+      return false;
+    }
+    return CarMovementPossibleByDistance(begin_position, distance, context);
+  }
+
+  double distance = manuever.GetFinalStraightSectionDistance();
+  if (end_position.IsAlongBaseLine() &&
+      DoubleIsGreater(distance, sampling_step)) {
+    return false;
+  }
+  CarPosition after_turn = begin_position;
+  after_turn.SetDirection(end_position.GetDirection());
+  after_turn.SetCenter(begin_position.GetCenter().Rotate(
+      manuever.GetRotationCenter(), manuever.GetTurnAngle()));
+  if (!CarMovementPossibleByDistance(after_turn, distance, context)) {
+    return false;
+  }
+  return CarMovementPossibleByAngle(begin_position, manuever.GetTurnAngle(),
+                                    manuever.GetRotationCenter(), context);
+}
+
+}  // namespace simulation
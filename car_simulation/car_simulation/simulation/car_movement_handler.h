@@ -1,52 +1,88 @@
-#ifndef SIMUALTION_CAR_MOVEMENT_HANDLER_H_
-#define SIMUALTION_CAR_MOVEMENT_HANDLER_H_
-
-#include "geometry/segment.h"
-#include "simulation/car_description.h"
-#include "utils/intersection_handler.h"
-
-#include <vector>
-
-namespace geometry {
-class Point;
-}  // namespace geometry
-
-namespace simulation {
-
-class Car;
-class CarManuever;
-class CarPosition;
-
-class CarMovementHandler {
- public:
-  CarMovementHandler(const utils::IntersectionHandler* intersection_handler,
-                     const CarDescription& car_description);
-
-  const utils::IntersectionHandler* GetIntersectionHandler() const;
-  const CarDescription& GetCarDescription() const;
-
-  bool CarMovementPossibleByDistance(const Car& car, double distance) const;
-  bool CarMovementPossibleByAngle(const Car& car, double angle) const;
-
-
-  bool CarMovementPossibleByDistance(const CarPosition& car_position,
-                                     double distance) const;
-  bool CarMovementPossibleByAngle(const CarPosition& car, double angle,
-                                  const geometry::Point& rotation_center) const;
-  bool SingleManueverBetweenStates(
-      const CarPosition& pos1, const CarPosition& pos2,
-      CarManuever &manuever) const;
-
- private:
-  bool ConstructManuever(const CarPosition& car1, const CarPosition& car2,
-                         const geometry::Point& rotation_center,
-                         CarManuever& manuever) const;
- private:
-  CarDescription carDescription_;
-  mutable std::vector<geometry::Segment> intersectedCache_;
-  const utils::IntersectionHandler* intersectionHandler_;
-};
-
-}  // namespace simulation
-
-#endif  // SIMUALTION_CAR_MOVEMENT_HANDLER_H_
+#ifndef SIMUALTION_CAR_MOVEMENT_HANDLER_H_
+#define SIMUALTION_CAR_MOVEMENT_HANDLER_H_
+
+#include "geometry/arc.h"
+#include "geometry/point.h"
+#include "geometry/polygon.h"
+#include "geometry/segment.h"
+#include "simulation/car_description.h"
+#include "simulation/collision_cache.h"
+#include "utils/intersection_handler.h"
+
+#include <memory>
+#include <vector>
+
+namespace simulation {
+
+class Car;
+class CarManuever;
+class CarPosition;
+
+// Buffers reused by the collision checks of a CarMovementHandler, so that
+// checking a manuever does not allocate once they have grown. A context may
+// be used by one thread at a time; every thread checking movements keeps a
+// context of its own.
+struct CarMovementContext {
+  std::vector<geometry::SegmentSpan> spans;
+  geometry::Polygon bounds;
+  geometry::Polygon endBounds;
+  std::vector<geometry::Point> points;
+  std::vector<geometry::Arc> arcs;
+};
+
+// Checks which movements of a car are possible in a layout. The handler does
+// not change once constructed, apart from its internally synchronized
+// collision cache, so a single handler may be shared by any number of
+// threads, each passing its own CarMovementContext to the queries.
+class CarMovementHandler {
+ public:
+  // If "intersection_handler" is NULL there are no obstacles and every
+  // movement is possible, which leaves only the geometry of the manuevers.
+  CarMovementHandler(const utils::IntersectionHandler* intersection_handler,
+                     const CarDescription& car_description);
+
+  const utils::IntersectionHandler* GetIntersectionHandler() const;
+  const CarDescription& GetCarDescription() const;
+
+  // The cache of the segments blocking straight movements. It is shared by
+  // the copies of the handler.
+  const CollisionCache& GetCollisionCache() const;
+
+  bool CarMovementPossibleByDistance(const Car& car, double distance,
+                                     CarMovementContext* context) const;
+  bool CarMovementPossibleByAngle(const Car& car, double angle,
+                                  CarMovementContext* context) const;
+
+
+  bool CarMovementPossibleByDistance(const CarPosition& car_position,
+                                     double distance,
+                                     CarMovementContext* context) const;
+  bool CarMovementPossibleByAngle(const CarPosition& car, double angle,
+                                  const geometry::Point& rotation_center,
+                                  CarMovementContext* context) const;
+  bool SingleManueverBetweenStates(
+      const CarPosition& pos1, const CarPosition& pos2,
+      CarManuever &manuever, CarMovementContext* context) const;
+
+  // Checks a manuever solved beforehand, e.g. by SingleManueverBetweenStates
+  // for the same relative positions, the way SingleManueverBetweenStates
+  // checks the one it constructs. "end_position" is where the manuever ends.
+  bool ManueverPossible(const CarManuever& manuever,
+                        const CarPosition& end_position,
+                        CarMovementContext* context) const;
+
+ private:
+  bool ConstructManuever(const CarPosition& car1, const CarPosition& car2,
+                         const geometry::Point& rotation_center,
+                         CarManuever& manuever,
+                         CarMovementContext* context) const;
+
+ private:
+  CarDescription carDescription_;
+  std::shared_ptr<CollisionCache> collisionCache_;
+  const utils::IntersectionHandler* intersectionHandler_;
+};
+
+}  // namespace simulation
+
+#endif  // SIMUALTION_CAR_MOVEMENT_HANDLER_H_
@@ -1,135 +1,402 @@
-#include "car_positions_container.h"
-
-#include "geometry/bounding_box.h"
-#include "simulation/car.h"
-
-namespace simulation {
-
-static const int VERTICAL_CELL_NUM = 200;
-static const int HORIZONTAL_CELL_NUM = 300;
-
-void CarPositionEntry::AddCarPosition(int position_index) {
-  carPositions_.push_back(position_index);
-}
-
-const std::vector<int>& CarPositionEntry::GetPositions() const {
-  return carPositions_;
-}
-
-CarPositionsContainer::CarPositionsContainer(
-    double minx, double maxx, double miny, double maxy)
-  : minx_(minx), maxx_(maxx), miny_(miny), maxy_(maxy) {
-  positionsGrid_.resize(VERTICAL_CELL_NUM);
-  for (int i = 0; i < VERTICAL_CELL_NUM; ++i) {
-    positionsGrid_[i].resize(HORIZONTAL_CELL_NUM);
-  }   
-}
-
-CarPositionsContainer::~CarPositionsContainer() {
-  for (unsigned i = 0; i < positions_.size(); ++i) {
-    delete positions_[i];
-  }
-}
-
-void CarPositionsContainer::AddCarPosition(
-    const CarPosition& position, const geometry::RectangleObject* object) {
-  int i, j;
-  GetCellCoordinates(position.GetCenter(), i, j);
-  positionsGrid_[i][j].AddCarPosition(positions_.size());
-
-  unsigned object_index = 0;
-  std::map<const geometry::RectangleObject*, unsigned>::iterator it =
-      objectsMap_.find(object);
-  if (it == objectsMap_.end()) {
-    object_index = objects_.size();
-    objectsMap_.insert(std::make_pair(object, object_index));
-    objects_.push_back(object);
-    positionsForObjects_.push_back(std::vector<int>());
-  } else {
-    object_index = it->second;
-  }
- 
-  positionsForObjects_[object_index].push_back(
-      static_cast<int>(positions_.size()));
-  positionObjectMap_.push_back(object_index);
-  positions_.push_back(new CarPosition(position));
-}
-
-std::vector<int> CarPositionsContainer::GetPositions(
-    const geometry::BoundingBox &bounding_box) const {
-  int mini, maxi, minj, maxj;
-  geometry::Point lower_left(bounding_box.GetMinX(), bounding_box.GetMinY());
-  geometry::Point upper_right(bounding_box.GetMaxX(), bounding_box.GetMaxY());
-  GetCellCoordinates(lower_left, mini, minj);
-  GetCellCoordinates(upper_right, maxi, maxj);
-  std::vector<int> result;
-  for (int i = mini; i <= maxi; ++i) {
-    for (int j = minj; j <= maxj; ++j) {
-      const std::vector<int>& positions =
-          positionsGrid_[i][j].GetPositions();
-      for (unsigned k = 0; k < positions.size(); ++k) {
-        const CarPosition* car_position = positions_[positions[k]];
-        if (bounding_box.Contains(car_position->GetCenter())) {
-          result.push_back(positions[k]);
-        }
-      }
-    }
-  }
-
-  return result;
-}
-
-std::vector<int> CarPositionsContainer::GetPositions() const {
-  std::vector<int> res;
-  for (unsigned i = 0; i < positions_.size(); ++i) {
-    res.push_back(i);
-  }
-  return res;
-}
-
-const CarPosition* CarPositionsContainer::GetPosition(
-    int position_index) const {
-  return positions_[position_index];
-}
-
-int CarPositionsContainer::GetNumberOfPositions() const {
-  return static_cast<int>(positions_.size());
-}
-
-unsigned CarPositionsContainer::GetNumberOfObjects() const {
-  return objects_.size();
-}
-
-const geometry::RectangleObject *CarPositionsContainer::GetObject(
-    int index) const {
-  return objects_[index];
-}
-
-unsigned CarPositionsContainer::GetObjectIndexForPosition(int position_index) {
-  return positionObjectMap_[position_index];
-}
-
-const std::vector<int>& CarPositionsContainer::GetCarPositionsForObject(
-    int object_index) const {
-  return positionsForObjects_[object_index];
-}
-
-void CarPositionsContainer::GetCellCoordinates(
-    const geometry::Point &point, int &i, int &j) const {
-  i = static_cast<int>(((point.x - minx_) * VERTICAL_CELL_NUM) / (maxx_ - minx_));
-  if (i >= VERTICAL_CELL_NUM) {
-    i = VERTICAL_CELL_NUM - 1;
-  }
-  if (i < 0) {
-    i = 0;
-  }
-  j = static_cast<int>(((point.y - miny_) * HORIZONTAL_CELL_NUM) / (maxy_ - miny_));
-  if (j >= HORIZONTAL_CELL_NUM) {
-    j = HORIZONTAL_CELL_NUM - 1;
-  }
-  if (j < 0) {
-    j = 0;
-  }
-}
-
-}  // namespace simulation
+#include "car_positions_container.h"
+
+#include "geometry/bounding_box.h"
+#include "geometry/geometry_utils.h"
+#include "simulation/car.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+namespace simulation {
+
+static const int VERTICAL_CELL_NUM = 200;
+static const int HORIZONTAL_CELL_NUM = 300;
+
+static const unsigned char FINAL_FLAG = 1;
+static const unsigned char ALONG_BASE_LINE_FLAG = 2;
+
+// The centers are sorted along a Hilbert curve over a square grid with
+// 2^HILBERT_ORDER cells per side, and the headings in a cell are split into
+// HEADING_BUCKETS intervals.
+static const int HILBERT_ORDER = 16;
+static const int HEADING_BUCKETS = 256;
+
+// The positions in a cell of the grid are grouped by heading into this many
+// buckets, the step between the headings sampled on an object being pi / 10.
+static const int CELL_HEADING_BUCKETS = 20;
+// Widens the heading intervals of the buckets passed to the filters to
+// cover the rounding of the headings.
+static const double HEADING_BUCKET_MARGIN = 1e-9;
+
+// Returns the distance along the Hilbert curve of the cell (x, y) of a grid
+// with 2^HILBERT_ORDER cells per side.
+static unsigned long long GetHilbertIndex(unsigned x, unsigned y) {
+  unsigned long long index = 0;
+  for (unsigned side = 1u << (HILBERT_ORDER - 1); side > 0; side /= 2) {
+    unsigned rx = (x & side) ? 1 : 0;
+    unsigned ry = (y & side) ? 1 : 0;
+    index += static_cast<unsigned long long>(side) * side * ((3 * rx) ^ ry);
+    // Rotates the quadrant so that the curve continues from its end.
+    if (ry == 0) {
+      if (rx == 1) {
+        x = side - 1 - x;
+        y = side - 1 - y;
+      }
+      std::swap(x, y);
+    }
+  }
+  return index;
+}
+
+// Returns the cell of "value" among "cells" equal cells splitting
+// [min_value, max_value].
+static unsigned GetCell(double value, double min_value, double max_value,
+                        unsigned cells) {
+  if (max_value <= min_value) {
+    return 0;
+  }
+  double cell = (value - min_value) / (max_value - min_value) * cells;
+  return std::min(static_cast<unsigned>(std::max(cell, 0.0)), cells - 1);
+}
+
+void CarPositionEntry::AddCarPosition(int position_index, int heading_bucket,
+                                      const geometry::Point& center) {
+  if (bucketBegins_.empty()) {
+    bucketBegins_.resize(CELL_HEADING_BUCKETS + 1, 0);
+  }
+  carPositions_.insert(
+      carPositions_.begin() + bucketBegins_[heading_bucket + 1],
+      position_index);
+  for (int bucket = heading_bucket + 1; bucket <= CELL_HEADING_BUCKETS;
+       ++bucket) {
+    ++bucketBegins_[bucket];
+  }
+  boundingBox_.AddPoint(center);
+}
+
+const std::vector<int>& CarPositionEntry::GetPositions() const {
+  return carPositions_;
+}
+
+int CarPositionEntry::GetBucketBegin(int heading_bucket) const {
+  return bucketBegins_.empty() ? 0 : bucketBegins_[heading_bucket];
+}
+
+const geometry::BoundingBox& CarPositionEntry::GetBoundingBox() const {
+  return boundingBox_;
+}
+
+void CarPositionEntry::Renumber(const std::vector<int>& new_indices) {
+  for (unsigned index = 0; index < carPositions_.size(); ++index) {
+    carPositions_[index] = new_indices[carPositions_[index]];
+  }
+  for (unsigned bucket = 0; bucket + 1 < bucketBegins_.size(); ++bucket) {
+    std::sort(carPositions_.begin() + bucketBegins_[bucket],
+              carPositions_.begin() + bucketBegins_[bucket + 1]);
+  }
+}
+
+CarPositionsContainer::CarPositionsContainer(
+    double minx, double maxx, double miny, double maxy)
+  : minx_(minx), maxx_(maxx), miny_(miny), maxy_(maxy) {
+  positionsGrid_.resize(VERTICAL_CELL_NUM);
+  for (int i = 0; i < VERTICAL_CELL_NUM; ++i) {
+    positionsGrid_[i].resize(HORIZONTAL_CELL_NUM);
+  }   
+}
+
+void CarPositionsContainer::AddCarPosition(
+    const CarPosition& position, const geometry::RectangleObject* object) {
+  int position_index = GetNumberOfPositions();
+  unsigned object_index = 0;
+  std::map<const geometry::RectangleObject*, unsigned>::iterator it =
+      objectsMap_.find(object);
+  if (it == objectsMap_.end()) {
+    object_index = objects_.size();
+    objectsMap_.insert(std::make_pair(object, object_index));
+    objects_.push_back(object);
+    positionsForObjects_.push_back(std::vector<int>());
+  } else {
+    object_index = it->second;
+  }
+ 
+  positionsForObjects_[object_index].push_back(position_index);
+  positionObjectMap_.push_back(object_index);
+  centerX_.push_back(position.GetCenter().x);
+  centerY_.push_back(position.GetCenter().y);
+  directionX_.push_back(position.GetDirection().x);
+  directionY_.push_back(position.GetDirection().y);
+  flags_.push_back((position.IsFinal() ? FINAL_FLAG : 0) |
+                   (position.IsAlongBaseLine() ? ALONG_BASE_LINE_FLAG : 0));
+  AddToGrid(position_index);
+}
+
+void CarPositionsContainer::Assign(
+    const std::vector<CarPosition>& positions,
+    const std::vector<unsigned>& position_objects,
+    const std::vector<const geometry::RectangleObject*>& objects,
+    const std::vector<std::vector<int> >& positions_for_objects) {
+  for (int i = 0; i < VERTICAL_CELL_NUM; ++i) {
+    for (int j = 0; j < HORIZONTAL_CELL_NUM; ++j) {
+      positionsGrid_[i][j] = CarPositionEntry();
+    }
+  }
+
+  int number_of_positions = static_cast<int>(positions.size());
+  centerX_.resize(number_of_positions);
+  centerY_.resize(number_of_positions);
+  directionX_.resize(number_of_positions);
+  directionY_.resize(number_of_positions);
+  flags_.resize(number_of_positions);
+  for (int index = 0; index < number_of_positions; ++index) {
+    const CarPosition& position = positions[index];
+    centerX_[index] = position.GetCenter().x;
+    centerY_[index] = position.GetCenter().y;
+    directionX_[index] = position.GetDirection().x;
+    directionY_[index] = position.GetDirection().y;
+    flags_[index] = (position.IsFinal() ? FINAL_FLAG : 0) |
+        (position.IsAlongBaseLine() ? ALONG_BASE_LINE_FLAG : 0);
+    AddToGrid(index);
+  }
+  positionObjectMap_ = position_objects;
+  objects_ = objects;
+  objectsMap_.clear();
+  for (unsigned index = 0; index < objects_.size(); ++index) {
+    objectsMap_.insert(std::make_pair(objects_[index], index));
+  }
+  positionsForObjects_ = positions_for_objects;
+}
+
+void CarPositionsContainer::SortSpatially(int first_position) {
+  int number_of_positions = GetNumberOfPositions();
+  if (first_position >= number_of_positions) {
+    return;
+  }
+  double min_x = *std::min_element(centerX_.begin() + first_position,
+                                   centerX_.end());
+  double max_x = *std::max_element(centerX_.begin() + first_position,
+                                   centerX_.end());
+  double min_y = *std::min_element(centerY_.begin() + first_position,
+                                   centerY_.end());
+  double max_y = *std::max_element(centerY_.begin() + first_position,
+                                   centerY_.end());
+  // Square cells keep the curve from stretching along one of the axes.
+  double side = std::max(max_x - min_x, max_y - min_y);
+  max_x = min_x + side;
+  max_y = min_y + side;
+
+  std::vector<std::pair<unsigned long long, int> > keys;
+  keys.reserve(number_of_positions - first_position);
+  for (int index = first_position; index < number_of_positions; ++index) {
+    unsigned cells = 1u << HILBERT_ORDER;
+    unsigned long long hilbert_index = GetHilbertIndex(
+        GetCell(centerX_[index], min_x, max_x, cells),
+        GetCell(centerY_[index], min_y, max_y, cells));
+    double heading = atan2(directionY_[index], directionX_[index]);
+    unsigned heading_bucket = GetCell(heading, -geometry::GeometryUtils::PI,
+                                      geometry::GeometryUtils::PI,
+                                      HEADING_BUCKETS);
+    keys.push_back(std::make_pair(
+        hilbert_index * HEADING_BUCKETS + heading_bucket, index));
+  }
+  // The old indices break the ties, so the order is deterministic.
+  std::sort(keys.begin(), keys.end());
+
+  std::vector<int> new_indices(number_of_positions);
+  for (int index = 0; index < first_position; ++index) {
+    new_indices[index] = index;
+  }
+  for (unsigned index = 0; index < keys.size(); ++index) {
+    new_indices[keys[index].second] = first_position + index;
+  }
+
+  std::vector<double> center_x(number_of_positions);
+  std::vector<double> center_y(number_of_positions);
+  std::vector<double> direction_x(number_of_positions);
+  std::vector<double> direction_y(number_of_positions);
+  std::vector<unsigned char> flags(number_of_positions);
+  std::vector<unsigned> position_objects(number_of_positions);
+  for (int index = 0; index < number_of_positions; ++index) {
+    int new_index = new_indices[index];
+    center_x[new_index] = centerX_[index];
+    center_y[new_index] = centerY_[index];
+    direction_x[new_index] = directionX_[index];
+    direction_y[new_index] = directionY_[index];
+    flags[new_index] = flags_[index];
+    position_objects[new_index] = positionObjectMap_[index];
+  }
+  centerX_.swap(center_x);
+  centerY_.swap(center_y);
+  directionX_.swap(direction_x);
+  directionY_.swap(direction_y);
+  flags_.swap(flags);
+  positionObjectMap_.swap(position_objects);
+
+  for (unsigned object = 0; object < positionsForObjects_.size(); ++object) {
+    std::vector<int>& positions = positionsForObjects_[object];
+    for (unsigned index = 0; index < positions.size(); ++index) {
+      positions[index] = new_indices[positions[index]];
+    }
+    std::sort(positions.begin(), positions.end());
+  }
+  for (unsigned i = 0; i < positionsGrid_.size(); ++i) {
+    for (unsigned j = 0; j < positionsGrid_[i].size(); ++j) {
+      positionsGrid_[i][j].Renumber(new_indices);
+    }
+  }
+}
+
+std::vector<int> CarPositionsContainer::GetPositions(
+    const geometry::BoundingBox &bounding_box) const {
+  int mini, maxi, minj, maxj;
+  geometry::Point lower_left(bounding_box.GetMinX(), bounding_box.GetMinY());
+  geometry::Point upper_right(bounding_box.GetMaxX(), bounding_box.GetMaxY());
+  GetCellCoordinates(lower_left, mini, minj);
+  GetCellCoordinates(upper_right, maxi, maxj);
+  std::vector<int> result;
+  for (int i = mini; i <= maxi; ++i) {
+    for (int j = minj; j <= maxj; ++j) {
+      const std::vector<int>& positions =
+          positionsGrid_[i][j].GetPositions();
+      for (unsigned k = 0; k < positions.size(); ++k) {
+        if (bounding_box.Contains(GetCenter(positions[k]))) {
+          result.push_back(positions[k]);
+        }
+      }
+    }
+  }
+
+  return result;
+}
+
+std::vector<int> CarPositionsContainer::GetPositions(
+    const geometry::BoundingBox& bounding_box,
+    const PositionGroupFilter& filter) const {
+  const double pi = geometry::GeometryUtils::PI;
+  const double bucket_width = 2.0 * pi / CELL_HEADING_BUCKETS;
+  int mini, maxi, minj, maxj;
+  geometry::Point lower_left(bounding_box.GetMinX(), bounding_box.GetMinY());
+  geometry::Point upper_right(bounding_box.GetMaxX(), bounding_box.GetMaxY());
+  GetCellCoordinates(lower_left, mini, minj);
+  GetCellCoordinates(upper_right, maxi, maxj);
+  std::vector<int> result;
+  for (int i = mini; i <= maxi; ++i) {
+    for (int j = minj; j <= maxj; ++j) {
+      const CarPositionEntry& entry = positionsGrid_[i][j];
+      const std::vector<int>& positions = entry.GetPositions();
+      if (positions.empty() ||
+          !bounding_box.Intersect(entry.GetBoundingBox())) {
+        continue;
+      }
+      for (int bucket = 0; bucket < CELL_HEADING_BUCKETS; ++bucket) {
+        int begin = entry.GetBucketBegin(bucket);
+        int end = entry.GetBucketBegin(bucket + 1);
+        if (begin == end) {
+          continue;
+        }
+        double min_heading = -pi + bucket * bucket_width;
+        if (!filter.MayContainWanted(
+            entry.GetBoundingBox(), min_heading - HEADING_BUCKET_MARGIN,
+            min_heading + bucket_width + HEADING_BUCKET_MARGIN)) {
+          continue;
+        }
+        for (int k = begin; k < end; ++k) {
+          if (bounding_box.Contains(GetCenter(positions[k]))) {
+            result.push_back(positions[k]);
+          }
+        }
+      }
+    }
+  }
+
+  return result;
+}
+
+std::vector<int> CarPositionsContainer::GetPositions() const {
+  std::vector<int> res;
+  for (int i = 0; i < GetNumberOfPositions(); ++i) {
+    res.push_back(i);
+  }
+  return res;
+}
+
+CarPosition CarPositionsContainer::GetPosition(int position_index) const {
+  CarPosition position;
+  position.SetCenter(GetCenter(position_index));
+  position.SetUnitDirection(GetDirection(position_index));
+  position.SetIsFinal((flags_[position_index] & FINAL_FLAG) != 0);
+  position.SetIsAlongBaseLine(
+      (flags_[position_index] & ALONG_BASE_LINE_FLAG) != 0);
+  return position;
+}
+
+geometry::Point CarPositionsContainer::GetCenter(int position_index) const {
+  return geometry::Point(centerX_[position_index], centerY_[position_index]);
+}
+
+geometry::Vector CarPositionsContainer::GetDirection(
+    int position_index) const {
+  return geometry::Vector(directionX_[position_index],
+                          directionY_[position_index]);
+}
+
+bool CarPositionsContainer::IsFinal(int position_index) const {
+  return (flags_[position_index] & FINAL_FLAG) != 0;
+}
+
+int CarPositionsContainer::GetNumberOfPositions() const {
+  return static_cast<int>(centerX_.size());
+}
+
+unsigned CarPositionsContainer::GetNumberOfObjects() const {
+  return objects_.size();
+}
+
+const geometry::RectangleObject *CarPositionsContainer::GetObject(
+    int index) const {
+  return objects_[index];
+}
+
+unsigned CarPositionsContainer::GetObjectIndexForPosition(
+    int position_index) const {
+  return positionObjectMap_[position_index];
+}
+
+const std::vector<int>& CarPositionsContainer::GetCarPositionsForObject(
+    int object_index) const {
+  return positionsForObjects_[object_index];
+}
+
+void CarPositionsContainer::AddToGrid(int position_index) {
+  int i, j;
+  GetCellCoordinates(GetCenter(position_index), i, j);
+  double heading = atan2(directionY_[position_index],
+                         directionX_[position_index]);
+  int heading_bucket = GetCell(heading, -geometry::GeometryUtils::PI,
+                               geometry::GeometryUtils::PI,
+                               CELL_HEADING_BUCKETS);
+  positionsGrid_[i][j].AddCarPosition(position_index, heading_bucket,
+                                      GetCenter(position_index));
+}
+
+void CarPositionsContainer::GetCellCoordinates(
+    const geometry::Point &point, int &i, int &j) const {
+  i = static_cast<int>(((point.x - minx_) * VERTICAL_CELL_NUM) / (maxx_ - minx_));
+  if (i >= VERTICAL_CELL_NUM) {
+    i = VERTICAL_CELL_NUM - 1;
+  }
+  if (i < 0) {
+    i = 0;
+  }
+  j = static_cast<int>(((point.y - miny_) * HORIZONTAL_CELL_NUM) / (maxy_ - miny_));
+  if (j >= HORIZONTAL_CELL_NUM) {
+    j = HORIZONTAL_CELL_NUM - 1;
+  }
+  if (j < 0) {
+    j = 0;
+  }
+}
+
+}  // namespace simulation
@@ -1,66 +1,122 @@
-#ifndef SIMUALTION_CAR_POSITIONS_CONTAINER_H
-#define SIMUALTION_CAR_POSITIONS_CONTAINER_H
-
-#include <map>
-#include <vector>
-
-namespace geometry {
-class BoundingBox;
-class Point;
-class RectangleObject;
-}  // namespace geometry
-
-namespace simulation {
-
-class CarPosition;
-
-class CarPositionEntry {
- public:
-  void AddCarPosition(int position_index);
-  const std::vector<int>& GetPositions() const;
-
- private:
-  std::vector<int> carPositions_;
-};
-
-class CarPositionsContainer {
- public:
-  CarPositionsContainer(double minx, double maxx, double miny, double maxy);
-  ~CarPositionsContainer();
-
-  void AddCarPosition(
-      const CarPosition& position, const geometry::RectangleObject* object);
-
-  std::vector<int> GetPositions(
-      const geometry::BoundingBox& bounding_box) const;
-
-  std::vector<int> GetPositions() const;
-
-  const CarPosition* GetPosition(int position_index) const;
-
-  int GetNumberOfPositions() const;
-
-  unsigned GetNumberOfObjects() const;
-  const geometry::RectangleObject* GetObject(int index) const;
-  unsigned GetObjectIndexForPosition(int position_index);
-  const std::vector<int>& GetCarPositionsForObject(int object_index) const;
-
- private:
-  void GetCellCoordinates(const geometry::Point& point, int& i, int& j) const;
-
- private:
-  std::vector<CarPosition*> positions_;
-  std::vector<unsigned> positionObjectMap_;
-  std::map<const geometry::RectangleObject*, unsigned> objectsMap_;
-  std::vector<const geometry::RectangleObject*> objects_;
-  std::vector<std::vector<int> > positionsForObjects_;
-  std::vector<std::vector<CarPositionEntry> > positionsGrid_;
-
-
-  double minx_, maxx_;
-  double miny_, maxy_;
-};
-
-}  // namespace simulation
-
-#endif // SIMUALTION_CAR_POSITIONS_CONTAINER_H
+#ifndef SIMUALTION_CAR_POSITIONS_CONTAINER_H
+#define SIMUALTION_CAR_POSITIONS_CONTAINER_H
+
+#include "geometry/bounding_box.h"
+#include "geometry/point.h"
+#include "geometry/vector.h"
+#include "simulation/car_position.h"
+
+#include <map>
+#include <vector>
+
+namespace geometry {
+class RectangleObject;
+}  // namespace geometry
+
+namespace simulation {
+
+// The positions with centers in a cell of the grid of a container, grouped
+// by the bucket of their heading.
+class CarPositionEntry {
+ public:
+  void AddCarPosition(int position_index, int heading_bucket,
+                      const geometry::Point& center);
+  // The positions ordered by heading bucket and then by index.
+  const std::vector<int>& GetPositions() const;
+  // The positions in "heading_bucket" are the ones from
+  // GetBucketBegin(heading_bucket) to GetBucketBegin(heading_bucket + 1) in
+  // GetPositions().
+  int GetBucketBegin(int heading_bucket) const;
+  // Bounds the centers of the positions.
+  const geometry::BoundingBox& GetBoundingBox() const;
+  // Replaces every position index with new_indices[index].
+  void Renumber(const std::vector<int>& new_indices);
+
+ private:
+  std::vector<int> carPositions_;
+  // Empty until the first position is added.
+  std::vector<int> bucketBegins_;
+  geometry::BoundingBox boundingBox_;
+};
+
+// Tells a query over the grid of a container which groups of positions it
+// may skip.
+class PositionGroupFilter {
+ public:
+  virtual ~PositionGroupFilter() {}
+
+  // Returns false if no position with a center in "bounding_box" and a
+  // heading angle between "min_heading" and "max_heading" is wanted.
+  virtual bool MayContainWanted(const geometry::BoundingBox& bounding_box,
+                                double min_heading,
+                                double max_heading) const = 0;
+};
+
+// Keeps the positions column by column, so that scans over many positions
+// read consecutive memory. The positions are accessed by index.
+class CarPositionsContainer {
+ public:
+  CarPositionsContainer(double minx, double maxx, double miny, double maxy);
+
+  void AddCarPosition(
+      const CarPosition& position, const geometry::RectangleObject* object);
+
+  // Replaces the contents of the container with "positions". The object of
+  // every position is given by its index in "objects" and the positions of
+  // every object are listed in "positions_for_objects" in the order in which
+  // they were added. Used to restore a container saved to a file.
+  void Assign(const std::vector<CarPosition>& positions,
+              const std::vector<unsigned>& position_objects,
+              const std::vector<const geometry::RectangleObject*>& objects,
+              const std::vector<std::vector<int> >& positions_for_objects);
+
+  // Renumbers the positions with indices from "first_position" on, so that
+  // positions close to each other in space and heading get close indices.
+  // They are ordered along a Hilbert curve over their centers, and positions
+  // in the same cell of the curve are ordered by heading.
+  void SortSpatially(int first_position);
+
+  std::vector<int> GetPositions(
+      const geometry::BoundingBox& bounding_box) const;
+  // Same as above but skips the groups of positions in a cell with the same
+  // heading bucket which "filter" rejects. The result is ordered by cell and
+  // then by heading.
+  std::vector<int> GetPositions(const geometry::BoundingBox& bounding_box,
+                                const PositionGroupFilter& filter) const;
+
+  std::vector<int> GetPositions() const;
+
+  CarPosition GetPosition(int position_index) const;
+  geometry::Point GetCenter(int position_index) const;
+  geometry::Vector GetDirection(int position_index) const;
+  bool IsFinal(int position_index) const;
+
+  int GetNumberOfPositions() const;
+
+  unsigned GetNumberOfObjects() const;
+  const geometry::RectangleObject* GetObject(int index) const;
+  unsigned GetObjectIndexForPosition(int position_index) const;
+  const std::vector<int>& GetCarPositionsForObject(int object_index) const;
+
+ private:
+  void GetCellCoordinates(const geometry::Point& point, int& i, int& j) const;
+  void AddToGrid(int position_index);
+
+ private:
+  std::vector<double> centerX_, centerY_;
+  std::vector<double> directionX_, directionY_;
+  std::vector<unsigned char> flags_;
+  std::vector<unsigned> positionObjectMap_;
+  std::map<const geometry::RectangleObject*, unsigned> objectsMap_;
+  std::vector<const geometry::RectangleObject*> objects_;
+  std::vector<std::vector<int> > positionsForObjects_;
+  std::vector<std::vector<CarPositionEntry> > positionsGrid_;
+
+
+  double minx_, maxx_;
+  double miny_, maxy_;
+};
+
+}  // namespace simulation
+
+#endif // SIMUALTION_CAR_POSITIONS_CONTAINER_H
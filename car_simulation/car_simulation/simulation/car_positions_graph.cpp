@@ -1,152 +1,1092 @@
-#include "simulation/car_positions_graph.h"
-
-#include "geometry/rectangle_object.h"
-#include "simulation/car.h"
-#include "simulation/car_movement_handler.h"
-#include "utils/benchmark.h"
-#include "utils/delay.h"
-#include "utils/double_utils.h"
-
-#include <iomanip>
-
-namespace simulation {
-
-static const double MIN_X_COORDINATE = -1000.0;
-static const double MAX_X_COORDINATE = 1000.0;
-static const double MIN_Y_COORDINATE = -1000.0;
-static const double MAX_Y_COORDINATE = 1000.0;
-
-CarPositionsGraph::CarPositionsGraph(const CarMovementHandler *movement_handler)
-  : movementHandler_(movement_handler),
-  positionsContainer_(MIN_X_COORDINATE, MAX_X_COORDINATE,
-                      MIN_Y_COORDINATE, MAX_Y_COORDINATE) {}
-
-void CarPositionsGraph::AddPosition(const CarPosition &position,
-                                    const geometry::RectangleObject* object) {
-  positionsContainer_.AddCarPosition(position, object);
-  if (positionsContainer_.GetNumberOfPositions() % 1000 == 0) {
-    std::cerr << "The size of the graph is now:"
-              << positionsContainer_.GetNumberOfPositions() << std::endl;
-  }
-}
-
-void CarPositionsGraph::GetNeighbourhoodList(
-    std::vector<std::vector<int> > &neighbour_list) {
-  unsigned number_of_objects = positionsContainer_.GetNumberOfObjects();
-  neighbour_list.clear();
-  neighbour_list.resize(number_of_objects);
-  for (unsigned i = 0; i < number_of_objects; ++i) {
-    neighbour_list[i].push_back(i);
-    for (unsigned j = i + 1; j < number_of_objects; ++j) {
-      if (geometry::AreTouching(*positionsContainer_.GetObject(i),
-                                *positionsContainer_.GetObject(j))) {
-        neighbour_list[i].push_back(j);
-        neighbour_list[j].push_back(i);
-      }
-    }
-  }
-}
-
-void CarPositionsGraph::FinalizeGraph() {
-  std::cerr << "Number of positions to build graph from: "
-            << positionsContainer_.GetNumberOfPositions() << std::endl;
-
-//  double start_time = get_time();
-  numberOfVertices_ = positionsContainer_.GetNumberOfPositions();
-  GetNeighbourhoodList(neighbourhoodList_);
-  graph_.resize(numberOfVertices_);
-  neighboursComputed_.resize(numberOfVertices_, false);
-//  int number_of_vertices = positionsContainer_.GetNumberOfPositions();
-//  graph_.resize(number_of_vertices);
-
-//  std::vector<std::vector<int> > neighbourhood_list;
-//  GetNeighbourhoodList(neighbourhood_list);
-//  int broi = 0;
-//  for (int i = 0; i < number_of_vertices; ++i) {
-//    if ((i+1) % 100 == 0) {
-//      std::cerr << "Now working on vertex: " << i << "\n";
-//      std::cerr << "Total edges: " << num << "\n";
-//      std::cerr << "Time consumed so far:" << std::setprecision(8)
-//                << get_time() - start_time << std::endl;
-//      utils::Benchmark::DumpBenchmarkingInfo();
-//    }
-//    GetPositionNeighbours(i, neighbourhood_list, graph_[i]);
-//  }
-}
-
-const CarDescription& CarPositionsGraph::GetCarDescription() const {
-  return movementHandler_->GetCarDescription();
-}
-
-//const std::vector<std::vector<GraphEdge> >&
-//    CarPositionsGraph::GetGraph() const {
-//  return graph_;
-//}
-
-bool CarPositionsGraph::IsPositionFinal(int position_index) const {
-  return positionsContainer_.GetPosition(position_index)->IsFinal();
-}
-
-int CarPositionsGraph::GetNumberOfVertices() const {
-  return graph_.size();
-}
-
-const CarPosition* CarPositionsGraph::GetPosition(int position_index) const {
-  return positionsContainer_.GetPosition(position_index);
-}
-
-const std::vector<GraphEdge>&
-    CarPositionsGraph::GetNeighbours(int position_index) {
-  if (!neighboursComputed_[position_index]) {
-    GetPositionNeighbours(position_index);
-    neighboursComputed_[position_index] = true;
-  }
-  return graph_[position_index];
-}
-
-void CarPositionsGraph::GetPositionNeighbours(int position_index) {
-  int object_index = positionsContainer_.
-      GetObjectIndexForPosition(position_index);
-  const CarPosition* car = positionsContainer_.GetPosition(position_index);
-  positionsContainer_.GetObject(object_index);
-  for (unsigned ne_idx = 0; ne_idx < neighbourhoodList_[object_index].size();
-       ++ne_idx) {
-    const std::vector<int>& positions = positionsContainer_.
-        GetCarPositionsForObject(neighbourhoodList_[object_index][ne_idx]);
-    for (unsigned pos_index = 0; pos_index < positions.size(); ++pos_index) {
-      if (positions[pos_index] == position_index) {
-        continue;
-      }
-      CarManuever manuever;
-      const CarPosition* car2 =
-          positionsContainer_.GetPosition(positions[pos_index]);
-
-      if (neighboursComputed_[positions[pos_index]]) {
-        continue;
-      }
-
-      if (movementHandler_->SingleManueverBetweenStates(
-          *car, *car2, manuever)) {
-        graph_[position_index].push_back(
-              std::make_pair(positions[pos_index], manuever));
-
-        // Add the reversed manuever.
-        manuever.SetReversed(true);
-        graph_[positions[pos_index]].push_back(
-              std::make_pair(position_index, manuever));
-      } else if (movementHandler_->SingleManueverBetweenStates(
-          *car2, *car, manuever)) {
-        graph_[positions[pos_index]].push_back(
-              std::make_pair(position_index, manuever));
-
-        // Add the reversed manuever.
-        manuever.SetReversed(true);
-        graph_[position_index].push_back(
-              std::make_pair(positions[pos_index], manuever));
-      }
-    }
-  }
-}
-
-
-}  // namespace simulation
+#include "simulation/car_positions_graph.h"
+
+#include "geometry/bounding_box.h"
+#include "geometry/geometry_utils.h"
+#include "geometry/point.h"
+#include "geometry/rectangle_object.h"
+#include "geometry/vector.h"
+#include "simulation/car.h"
+#include "simulation/car_movement_handler.h"
+#include "simulation/manuever_library.h"
+#include "utils/benchmark.h"
+#include "utils/binary_file.h"
+#include "utils/delay.h"
+#include "utils/double_utils.h"
+#include "utils/mapped_file.h"
+#include "utils/thread_pool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace simulation {
+
+static const double MIN_X_COORDINATE = -1000.0;
+static const double MAX_X_COORDINATE = 1000.0;
+static const double MIN_Y_COORDINATE = -1000.0;
+static const double MAX_Y_COORDINATE = 1000.0;
+
+// By default positions are only connected if their centers are closer than
+// this many diameters of the tightest turn of the car.
+static const double DEFAULT_MANUEVER_REACH_IN_TURNING_DIAMETERS = 2.5;
+
+// A saved graph starts with a GraphFileHeader followed by the arrays of the
+// graph, written as described in utils/binary_file.h.
+static const char GRAPH_FILE_MAGIC[8] = {'C', 'P', 'G', 'R', 'A', 'P', 'H', 0};
+// Should be increased on every change of the format.
+static const unsigned GRAPH_FILE_VERSION = 4;
+static const unsigned GRAPH_FILE_BYTE_ORDER = 0x01020304;
+
+static const unsigned char FINAL_POSITION_FLAG = 1;
+static const unsigned char ALONG_BASE_LINE_FLAG = 2;
+
+// The header is written and read in place, so its fields are ordered to be
+// aligned without any padding of the compiler and it takes 40 bytes on every
+// platform.
+struct GraphFileHeader {
+  char magic[8];
+  unsigned version;
+  unsigned byteOrder;
+  unsigned long long key;
+  int numberOfPositions;
+  int numberOfObjects;
+  int numberOfEdges;
+  int padding;
+};
+typedef char GraphFileHeaderSizeCheck[sizeof(GraphFileHeader) == 40 ? 1 : -1];
+
+// Throws if "indices" has values outside [0, limit).
+static void CheckIndices(const std::vector<int>& indices, int limit) {
+  for (unsigned index = 0; index < indices.size(); ++index) {
+    if (indices[index] < 0 || indices[index] >= limit) {
+      throw std::runtime_error("The graph file is corrupted.");
+    }
+  }
+}
+
+// Throws if "offsets" do not split [0, size) into consecutive intervals.
+static void CheckOffsets(const std::vector<int>& offsets, int size) {
+  if (offsets.front() != 0 || offsets.back() != size) {
+    throw std::runtime_error("The graph file is corrupted.");
+  }
+  for (unsigned index = 1; index < offsets.size(); ++index) {
+    if (offsets[index] < offsets[index - 1]) {
+      throw std::runtime_error("The graph file is corrupted.");
+    }
+  }
+}
+
+// Computes the edges of one vertex per task. All the threads share the
+// movement handler, each with a context of its own, and store the edges they
+// find in buffers of their own. The range of the
+// buffer holding the edges of every vertex is remembered so that the buffers
+// can be stitched in vertex order afterwards.
+class EdgesComputationTask : public utils::ParallelTask {
+ public:
+  EdgesComputationTask(const CarPositionsGraph* graph,
+                       int number_of_threads)
+    : graph_(graph),
+      movementContexts_(number_of_threads),
+      edges_(number_of_threads),
+      vertexThread_(graph->numberOfVertices_),
+      vertexEdgesBegin_(graph->numberOfVertices_),
+      vertexEdgesEnd_(graph->numberOfVertices_) {}
+
+  virtual void Run(int task_index, int thread_index) {
+    std::vector<std::pair<int, GraphEdge> >& edges = edges_[thread_index];
+    vertexThread_[task_index] = thread_index;
+    vertexEdgesBegin_[task_index] = edges.size();
+    graph_->ComputeEdgesToFollowingPositions(
+        task_index, &movementContexts_[thread_index], &edges);
+    vertexEdgesEnd_[task_index] = edges.size();
+  }
+
+  // Stores the edges found in the compressed sparse row arrays of "graph".
+  // The edges of every vertex are in the order in which a serial
+  // computation would have found them.
+  void StitchEdges(CarPositionsGraph* graph) const {
+    int number_of_vertices = graph->numberOfVertices_;
+    std::vector<int>& offsets = graph->edgeOffsets_;
+    offsets.assign(number_of_vertices + 1, 0);
+    for (unsigned thread = 0; thread < edges_.size(); ++thread) {
+      for (unsigned index = 0; index < edges_[thread].size(); ++index) {
+        ++offsets[edges_[thread][index].first + 1];
+      }
+    }
+    for (int vertex = 0; vertex < number_of_vertices; ++vertex) {
+      offsets[vertex + 1] += offsets[vertex];
+    }
+
+    int number_of_edges = offsets[number_of_vertices];
+    graph->edgeTargets_.resize(number_of_edges);
+    graph->edgeCosts_.resize(number_of_edges);
+    CarPositionsGraph::ManueverTable& manuevers = graph->manuevers_;
+    manuevers.beginPositions.resize(number_of_edges);
+    manuevers.initialStraightSectionDistances.resize(number_of_edges);
+    manuevers.finalStraightSectionDistances.resize(number_of_edges);
+    manuevers.turnAngles.resize(number_of_edges);
+    manuevers.rotationCenters.resize(number_of_edges);
+    manuevers.reversed.resize(number_of_edges);
+
+    std::vector<int> next_edge(offsets.begin(), offsets.end() - 1);
+    for (int vertex = 0; vertex < number_of_vertices; ++vertex) {
+      const std::vector<std::pair<int, GraphEdge> >& edges =
+          edges_[vertexThread_[vertex]];
+      for (unsigned index = vertexEdgesBegin_[vertex];
+           index < vertexEdgesEnd_[vertex]; ++index) {
+        int from = edges[index].first;
+        graph->StoreEdge(next_edge[from]++, from, edges[index].second);
+      }
+    }
+  }
+
+ private:
+  const CarPositionsGraph* graph_;
+  std::vector<CarMovementContext> movementContexts_;
+
+  // For every thread the edges found as pairs (from, edge).
+  std::vector<std::vector<std::pair<int, GraphEdge> > > edges_;
+  std::vector<int> vertexThread_;
+  std::vector<unsigned> vertexEdgesBegin_;
+  std::vector<unsigned> vertexEdgesEnd_;
+};
+
+// Returns true if the directions of the two positions are parallel and
+// CarMovementHandler::SingleManueverBetweenStates rejects the manuever from
+// the first to the second because of that: a car can only go straight to a
+// position with the same heading on its line and can only turn around to one
+// with the opposite heading off its line.
+static bool IsParallelManueverImpossible(const geometry::Point& center1,
+                                         const geometry::Vector& direction1,
+                                         const geometry::Point& center2,
+                                         const geometry::Vector& direction2) {
+  if (!DoubleIsZero(direction1.CrossProduct(direction2))) {
+    return false;
+  }
+  geometry::Vector vector(center1, center2);
+  if (DoubleIsZero(vector.CrossProduct(direction1))) {
+    return DoubleIsGreaterOrEqual(0, direction1.DotProduct(direction2)) ||
+        DoubleIsGreaterOrEqual(0, vector.DotProduct(direction2));
+  }
+  return DoubleIsGreaterOrEqual(direction1.DotProduct(direction2), 0);
+}
+
+// Manuevers are only ruled out by the cone test below if the cross products
+// are at least this far on the wrong side of zero.
+static const double MANUEVER_CONE_TOLERANCE = 1e-6;
+
+// Returns true if no manuever in either direction connects two positions
+// with non-parallel directions, given the middles of their rear axes. A
+// manuever turns forward around a point on the rear axis and then goes
+// forward along "direction2", so every direction of the rear axis middle
+// lies between "direction1" and "direction2" and its displacement is a
+// non-negative combination of the two. The manuever in the other direction
+// gives a non-positive combination.
+static bool IsOutsideManueverCones(const geometry::Point& rear_middle1,
+                                   const geometry::Vector& direction1,
+                                   const geometry::Point& rear_middle2,
+                                   const geometry::Vector& direction2) {
+  geometry::Vector displacement(rear_middle1, rear_middle2);
+  // The coefficients of "direction1" and "direction2" multiplied by the
+  // cross product of the directions.
+  double first = displacement.CrossProduct(direction2);
+  double second = direction1.CrossProduct(displacement);
+  return (first < -MANUEVER_CONE_TOLERANCE &&
+          second > MANUEVER_CONE_TOLERANCE) ||
+      (first > MANUEVER_CONE_TOLERANCE &&
+       second < -MANUEVER_CONE_TOLERANCE);
+}
+
+// Stores in "min_value" and "max_value" the bounds of the sine of the angles
+// from "from" to "to".
+static void GetSineRange(double from, double to,
+                         double* min_value, double* max_value) {
+  const double pi = geometry::GeometryUtils::PI;
+  *min_value = std::min(sin(from), sin(to));
+  *max_value = std::max(sin(from), sin(to));
+  if (pi * 0.5 + 2.0 * pi * ceil((from - pi * 0.5) / (2.0 * pi)) <= to) {
+    *max_value = 1.0;
+  }
+  if (-pi * 0.5 + 2.0 * pi * ceil((from + pi * 0.5) / (2.0 * pi)) <= to) {
+    *min_value = -1.0;
+  }
+}
+
+// Skips the groups of positions none of which passes IsOutsideManueverCones
+// with the position the filter is made for. The products in the test are
+// bounded over the centers and the headings of a group.
+class ManueverConeFilter : public PositionGroupFilter {
+ public:
+  ManueverConeFilter(const geometry::Point& rear_middle,
+                     const geometry::Vector& direction,
+                     double rear_axis_offset)
+      : rearMiddle_(rear_middle),
+        direction_(direction),
+        heading_(atan2(direction.y, direction.x)),
+        rearAxisOffset_(rear_axis_offset) {}
+
+  virtual bool MayContainWanted(const geometry::BoundingBox& bounding_box,
+                                double min_heading,
+                                double max_heading) const {
+    const double pi = geometry::GeometryUtils::PI;
+    // The cone test does not apply to positions parallel to this one.
+    double from = min_heading - heading_;
+    double to = max_heading - heading_;
+    if (ceil(from / pi) * pi <= to) {
+      return true;
+    }
+
+    geometry::Point corners[4] = {
+      geometry::Point(bounding_box.GetMinX(), bounding_box.GetMinY()),
+      geometry::Point(bounding_box.GetMinX(), bounding_box.GetMaxY()),
+      geometry::Point(bounding_box.GetMaxX(), bounding_box.GetMinY()),
+      geometry::Point(bounding_box.GetMaxX(), bounding_box.GetMaxY())
+    };
+    // The first product is the cross product of the vector from the rear
+    // axis middle of this position to the center of the other one with the
+    // other direction. The second is the cross product of this direction
+    // with the vector between the rear axis middles.
+    double min_first = 0.0, max_first = 0.0;
+    double min_second = 0.0, max_second = 0.0;
+    for (int corner = 0; corner < 4; ++corner) {
+      geometry::Vector vector(rearMiddle_, corners[corner]);
+      double length = vector.Length();
+      double min_sine, max_sine;
+      GetSineRange(min_heading - atan2(vector.y, vector.x),
+                   max_heading - atan2(vector.y, vector.x),
+                   &min_sine, &max_sine);
+      double second = direction_.CrossProduct(vector);
+      if (corner == 0) {
+        min_first = length * min_sine;
+        max_first = length * max_sine;
+        min_second = max_second = second;
+      } else {
+        min_first = std::min(min_first, length * min_sine);
+        max_first = std::max(max_first, length * max_sine);
+        min_second = std::min(min_second, second);
+        max_second = std::max(max_second, second);
+      }
+    }
+    double min_sine, max_sine;
+    GetSineRange(from, to, &min_sine, &max_sine);
+    min_second -= rearAxisOffset_ * max_sine;
+    max_second -= rearAxisOffset_ * min_sine;
+
+    return !((max_first < -MANUEVER_CONE_TOLERANCE &&
+              min_second > MANUEVER_CONE_TOLERANCE) ||
+             (min_first > MANUEVER_CONE_TOLERANCE &&
+              max_second < -MANUEVER_CONE_TOLERANCE));
+  }
+
+ private:
+  geometry::Point rearMiddle_;
+  geometry::Vector direction_;
+  double heading_;
+  double rearAxisOffset_;
+};
+
+// Orders object indices by the left side of their boxes.
+struct BoxMinXLess {
+  BoxMinXLess(const std::vector<geometry::BoundingBox>& boxes)
+      : boxes_(boxes) {}
+
+  bool operator()(int lhs, int rhs) const {
+    return boxes_[lhs].GetMinX() < boxes_[rhs].GetMinX();
+  }
+
+  const std::vector<geometry::BoundingBox>& boxes_;
+};
+
+CarPositionsGraph::CarPositionsGraph(const CarMovementHandler *movement_handler)
+  : movementHandler_(movement_handler),
+  positionsContainer_(MIN_X_COORDINATE, MAX_X_COORDINATE,
+                      MIN_Y_COORDINATE, MAX_Y_COORDINATE),
+  numberOfVertices_(0),
+  numberOfFixedPositions_(0),
+  manueverReachInTurningDiameters_(
+      DEFAULT_MANUEVER_REACH_IN_TURNING_DIAMETERS),
+  manueverReach_(0.0),
+  manueverLibrary_(NULL),
+  frozen_(false) {}
+
+void CarPositionsGraph::AddPosition(const CarPosition &position,
+                                    const geometry::RectangleObject* object) {
+  positionsContainer_.AddCarPosition(position, object);
+  if (positionsContainer_.GetNumberOfPositions() % 1000 == 0) {
+    std::cerr << "The size of the graph is now:"
+              << positionsContainer_.GetNumberOfPositions() << std::endl;
+  }
+}
+
+void CarPositionsGraph::GetNeighbourhoodList(
+    std::vector<std::vector<int> > &neighbour_list) {
+  int number_of_objects = positionsContainer_.GetNumberOfObjects();
+  neighbour_list.clear();
+  neighbour_list.resize(number_of_objects);
+
+  // Sweeps the touching boxes of the objects along the x axis, so that only
+  // the pairs whose boxes overlap are checked with AreTouching.
+  std::vector<geometry::BoundingBox> boxes(number_of_objects);
+  std::vector<int> order(number_of_objects);
+  for (int i = 0; i < number_of_objects; ++i) {
+    boxes[i] = geometry::GetTouchingBoundingBox(
+        *positionsContainer_.GetObject(i));
+    order[i] = i;
+  }
+  std::sort(order.begin(), order.end(), BoxMinXLess(boxes));
+
+  for (int i = 0; i < number_of_objects; ++i) {
+    neighbour_list[i].push_back(i);
+  }
+  for (int i = 0; i < number_of_objects; ++i) {
+    const geometry::BoundingBox& box = boxes[order[i]];
+    for (int j = i + 1; j < number_of_objects; ++j) {
+      const geometry::BoundingBox& other = boxes[order[j]];
+      if (other.GetMinX() > box.GetMaxX()) {
+        break;
+      }
+      if (!box.Intersect(other)) {
+        continue;
+      }
+      int first = std::min(order[i], order[j]);
+      int second = std::max(order[i], order[j]);
+      if (geometry::AreTouching(*positionsContainer_.GetObject(first),
+                                *positionsContainer_.GetObject(second))) {
+        neighbour_list[first].push_back(second);
+        neighbour_list[second].push_back(first);
+      }
+    }
+  }
+  // Keeps the lists in increasing order, as a scan over all pairs would.
+  for (int i = 0; i < number_of_objects; ++i) {
+    std::sort(neighbour_list[i].begin(), neighbour_list[i].end());
+  }
+}
+
+void CarPositionsGraph::SetNumberOfFixedPositions(int number_of_positions) {
+  numberOfFixedPositions_ = number_of_positions;
+}
+
+int CarPositionsGraph::GetNumberOfFixedPositions() const {
+  return numberOfFixedPositions_;
+}
+
+void CarPositionsGraph::SetManueverLibrary(const ManueverLibrary* library) {
+  manueverLibrary_ = library;
+}
+
+const ManueverLibrary* CarPositionsGraph::GetManueverLibrary() const {
+  return manueverLibrary_;
+}
+
+void CarPositionsGraph::SetManueverReach(double turning_diameters) {
+  manueverReachInTurningDiameters_ = turning_diameters;
+}
+
+double CarPositionsGraph::GetManueverReach() const {
+  return manueverReachInTurningDiameters_ * 2.0 *
+      GetCarDescription().GetMinTurningRadius();
+}
+
+// static
+double CarPositionsGraph::GetDefaultManueverReach(
+    const CarDescription& car_description) {
+  return DEFAULT_MANUEVER_REACH_IN_TURNING_DIAMETERS * 2.0 *
+      car_description.GetMinTurningRadius();
+}
+
+void CarPositionsGraph::FinalizeGraph() {
+  std::cerr << "Number of positions to build graph from: "
+            << positionsContainer_.GetNumberOfPositions() << std::endl;
+  positionsContainer_.SortSpatially(numberOfFixedPositions_);
+
+//  double start_time = get_time();
+  numberOfVertices_ = positionsContainer_.GetNumberOfPositions();
+  PrepareManueverSearch();
+  graph_.resize(numberOfVertices_);
+  neighboursComputed_.resize(numberOfVertices_, false);
+//  int number_of_vertices = positionsContainer_.GetNumberOfPositions();
+//  graph_.resize(number_of_vertices);
+
+//  std::vector<std::vector<int> > neighbourhood_list;
+//  GetNeighbourhoodList(neighbourhood_list);
+//  int broi = 0;
+//  for (int i = 0; i < number_of_vertices; ++i) {
+//    if ((i+1) % 100 == 0) {
+//      std::cerr << "Now working on vertex: " << i << "\n";
+//      std::cerr << "Total edges: " << num << "\n";
+//      std::cerr << "Time consumed so far:" << std::setprecision(8)
+//                << get_time() - start_time << std::endl;
+//      utils::Benchmark::DumpBenchmarkingInfo();
+//    }
+//    GetPositionNeighbours(i, neighbourhood_list, graph_[i]);
+//  }
+}
+
+void CarPositionsGraph::FinalizeGraphEagerly(utils::ThreadPool* thread_pool) {
+  FinalizeGraph();
+  BENCHMARK_STR("Eager edge computation");
+
+  int number_of_threads = 1;
+  if (thread_pool != NULL) {
+    number_of_threads = thread_pool->GetNumberOfThreads();
+  }
+  EdgesComputationTask task(this, number_of_threads);
+  if (thread_pool != NULL) {
+    thread_pool->ParallelFor(numberOfVertices_, &task);
+  } else {
+    for (int vertex = 0; vertex < numberOfVertices_; ++vertex) {
+      task.Run(vertex, 0);
+    }
+  }
+  task.StitchEdges(this);
+  graph_.clear();
+  neighboursComputed_.assign(numberOfVertices_, true);
+  frozen_ = true;
+}
+
+void CarPositionsGraph::PrepareManueverSearch() {
+  manueverReach_ = GetManueverReach();
+  GetNeighbourhoodList(neighbourhoodList_);
+  int number_of_objects = positionsContainer_.GetNumberOfObjects();
+  objectAxes_.resize(number_of_objects);
+  for (int index = 0; index < number_of_objects; ++index) {
+    const geometry::RectangleObject* object =
+        positionsContainer_.GetObject(index);
+    objectAxes_[index] =
+        geometry::Vector(object->GetFrom(), object->GetTo()).Unit();
+  }
+}
+
+void CarPositionsGraph::StoreEdge(int edge_index, int from,
+                                  const GraphEdge& edge) {
+  int to = edge.first;
+  const CarManuever& manuever = edge.second;
+  edgeTargets_[edge_index] = to;
+  edgeCosts_[edge_index] = manuever.GetTotalDistance();
+  // A reversed manuever is stored as the one it reverses.
+  manuevers_.beginPositions[edge_index] = manuever.IsReversed() ? to : from;
+  manuevers_.initialStraightSectionDistances[edge_index] =
+      manuever.GetInitialStraightSectionDistance();
+  manuevers_.finalStraightSectionDistances[edge_index] =
+      manuever.GetFinalStraightSectionDistance();
+  manuevers_.turnAngles[edge_index] = manuever.GetTurnAngle();
+  manuevers_.rotationCenters[edge_index] = manuever.GetRotationCenter();
+  manuevers_.reversed[edge_index] = manuever.IsReversed();
+}
+
+void CarPositionsGraph::ConnectFixedPositions() {
+  PrepareManueverSearch();
+  std::vector<std::pair<int, GraphEdge> > edges;
+  for (int index = 0; index < numberOfFixedPositions_; ++index) {
+    ComputeEdgesToFollowingPositions(index, &movementContext_, &edges);
+  }
+  if (edges.empty()) {
+    return;
+  }
+
+  std::vector<int> new_edges(numberOfVertices_, 0);
+  for (unsigned index = 0; index < edges.size(); ++index) {
+    ++new_edges[edges[index].first];
+  }
+  std::vector<int> offsets(numberOfVertices_ + 1, 0);
+  for (int vertex = 0; vertex < numberOfVertices_; ++vertex) {
+    offsets[vertex + 1] = offsets[vertex] + new_edges[vertex] +
+        edgeOffsets_[vertex + 1] - edgeOffsets_[vertex];
+  }
+
+  // Moves the edges of every vertex behind the room left for its new edges.
+  int number_of_edges = offsets[numberOfVertices_];
+  std::vector<int> targets(number_of_edges);
+  std::vector<double> costs(number_of_edges);
+  ManueverTable manuevers;
+  manuevers.beginPositions.resize(number_of_edges);
+  manuevers.initialStraightSectionDistances.resize(number_of_edges);
+  manuevers.finalStraightSectionDistances.resize(number_of_edges);
+  manuevers.turnAngles.resize(number_of_edges);
+  manuevers.rotationCenters.resize(number_of_edges);
+  manuevers.reversed.resize(number_of_edges);
+  for (int vertex = 0; vertex < numberOfVertices_; ++vertex) {
+    int edge = offsets[vertex] + new_edges[vertex];
+    for (int old_edge = edgeOffsets_[vertex];
+         old_edge < edgeOffsets_[vertex + 1]; ++old_edge, ++edge) {
+      targets[edge] = edgeTargets_[old_edge];
+      costs[edge] = edgeCosts_[old_edge];
+      manuevers.beginPositions[edge] = manuevers_.beginPositions[old_edge];
+      manuevers.initialStraightSectionDistances[edge] =
+          manuevers_.initialStraightSectionDistances[old_edge];
+      manuevers.finalStraightSectionDistances[edge] =
+          manuevers_.finalStraightSectionDistances[old_edge];
+      manuevers.turnAngles[edge] = manuevers_.turnAngles[old_edge];
+      manuevers.rotationCenters[edge] = manuevers_.rotationCenters[old_edge];
+      manuevers.reversed[edge] = manuevers_.reversed[old_edge];
+    }
+  }
+  edgeTargets_.swap(targets);
+  edgeCosts_.swap(costs);
+  std::swap(manuevers_, manuevers);
+
+  std::vector<int> next_edge(offsets.begin(), offsets.end() - 1);
+  for (unsigned index = 0; index < edges.size(); ++index) {
+    int from = edges[index].first;
+    StoreEdge(next_edge[from]++, from, edges[index].second);
+  }
+  edgeOffsets_.swap(offsets);
+}
+
+bool CarPositionsGraph::IsFrozen() const {
+  return frozen_;
+}
+
+int CarPositionsGraph::GetEdgesBegin(int position_index) const {
+  return edgeOffsets_[position_index];
+}
+
+int CarPositionsGraph::GetEdgesEnd(int position_index) const {
+  return edgeOffsets_[position_index + 1];
+}
+
+int CarPositionsGraph::GetEdgeTarget(int edge_index) const {
+  return edgeTargets_[edge_index];
+}
+
+double CarPositionsGraph::GetEdgeCost(int edge_index) const {
+  return edgeCosts_[edge_index];
+}
+
+CarManuever CarPositionsGraph::GetEdgeManuever(int edge_index) const {
+  CarManuever manuever(positionsContainer_.GetPosition(
+      manuevers_.beginPositions[edge_index]));
+  manuever.SetInitialStraightSectionDistance(
+      manuevers_.initialStraightSectionDistances[edge_index]);
+  manuever.SetFinalStraightSectionDistance(
+      manuevers_.finalStraightSectionDistances[edge_index]);
+  manuever.SetTurnAngle(manuevers_.turnAngles[edge_index]);
+  manuever.SetRotationCenter(manuevers_.rotationCenters[edge_index]);
+  manuever.SetReversed(manuevers_.reversed[edge_index]);
+  return manuever;
+}
+
+const CarDescription& CarPositionsGraph::GetCarDescription() const {
+  return movementHandler_->GetCarDescription();
+}
+
+//const std::vector<std::vector<GraphEdge> >&
+//    CarPositionsGraph::GetGraph() const {
+//  return graph_;
+//}
+
+bool CarPositionsGraph::IsPositionFinal(int position_index) const {
+  return positionsContainer_.IsFinal(position_index);
+}
+
+void CarPositionsGraph::GetFinalObjects(
+    std::vector<const geometry::RectangleObject*>* objects) const {
+  objects->clear();
+  for (unsigned object_index = 0;
+       object_index < positionsContainer_.GetNumberOfObjects();
+       ++object_index) {
+    const std::vector<int>& positions =
+        positionsContainer_.GetCarPositionsForObject(object_index);
+    for (unsigned index = 0; index < positions.size(); ++index) {
+      if (IsPositionFinal(positions[index])) {
+        objects->push_back(positionsContainer_.GetObject(object_index));
+        break;
+      }
+    }
+  }
+}
+
+void CarPositionsGraph::GetFinalPositionsForObject(
+    const geometry::RectangleObject* object,
+    std::vector<int>* positions) const {
+  positions->clear();
+  for (unsigned object_index = 0;
+       object_index < positionsContainer_.GetNumberOfObjects();
+       ++object_index) {
+    if (positionsContainer_.GetObject(object_index) != object) {
+      continue;
+    }
+    const std::vector<int>& object_positions =
+        positionsContainer_.GetCarPositionsForObject(object_index);
+    for (unsigned index = 0; index < object_positions.size(); ++index) {
+      if (IsPositionFinal(object_positions[index])) {
+        positions->push_back(object_positions[index]);
+      }
+    }
+  }
+}
+
+int CarPositionsGraph::GetNumberOfVertices() const {
+  return numberOfVertices_;
+}
+
+int CarPositionsGraph::GetNumberOfPositions() const {
+  return positionsContainer_.GetNumberOfPositions();
+}
+
+void CarPositionsGraph::SaveFrozenGraph(
+    const std::string& file, unsigned long long key,
+    const std::vector<const geometry::RectangleObject*>& objects) const {
+  if (!frozen_) {
+    throw std::runtime_error("Only frozen graphs can be saved.");
+  }
+  std::map<const geometry::RectangleObject*, int> object_indices;
+  for (unsigned index = 0; index < objects.size(); ++index) {
+    object_indices.insert(std::make_pair(objects[index], index));
+  }
+
+  // The fixed positions come first, so the saved positions are renumbered
+  // from 0.
+  int first_position = numberOfFixedPositions_;
+  int number_of_positions = numberOfVertices_ - first_position;
+
+  // The objects with saved positions are stored in the order of "objects",
+  // which is the order in which a graph without fixed positions adds them.
+  std::vector<std::pair<int, int> > saved_objects;
+  for (unsigned index = 0;
+       index < positionsContainer_.GetNumberOfObjects(); ++index) {
+    const std::vector<int>& positions =
+        positionsContainer_.GetCarPositionsForObject(index);
+    if (positions.empty() || positions.back() < first_position) {
+      continue;
+    }
+    std::map<const geometry::RectangleObject*, int>::const_iterator it =
+        object_indices.find(positionsContainer_.GetObject(index));
+    if (it == object_indices.end()) {
+      throw std::runtime_error(
+          "A position of the graph lies on an unknown object.");
+    }
+    saved_objects.push_back(std::make_pair(it->second, index));
+  }
+  std::sort(saved_objects.begin(), saved_objects.end());
+
+  int number_of_objects = saved_objects.size();
+  std::vector<int> saved_object_indices(
+      positionsContainer_.GetNumberOfObjects(), -1);
+  std::vector<int> objects_in_file(number_of_objects);
+  std::vector<int> object_position_offsets(1, 0);
+  std::vector<int> object_positions;
+  for (int index = 0; index < number_of_objects; ++index) {
+    objects_in_file[index] = saved_objects[index].first;
+    saved_object_indices[saved_objects[index].second] = index;
+    const std::vector<int>& positions =
+        positionsContainer_.GetCarPositionsForObject(
+            saved_objects[index].second);
+    for (unsigned position = 0; position < positions.size(); ++position) {
+      if (positions[position] >= first_position) {
+        object_positions.push_back(positions[position] - first_position);
+      }
+    }
+    object_position_offsets.push_back(object_positions.size());
+  }
+
+  std::vector<double> center_x(number_of_positions);
+  std::vector<double> center_y(number_of_positions);
+  std::vector<double> direction_x(number_of_positions);
+  std::vector<double> direction_y(number_of_positions);
+  std::vector<unsigned char> flags(number_of_positions);
+  std::vector<int> position_objects(number_of_positions);
+  for (int index = 0; index < number_of_positions; ++index) {
+    CarPosition position =
+        positionsContainer_.GetPosition(first_position + index);
+    center_x[index] = position.GetCenter().x;
+    center_y[index] = position.GetCenter().y;
+    direction_x[index] = position.GetDirection().x;
+    direction_y[index] = position.GetDirection().y;
+    flags[index] = (position.IsFinal() ? FINAL_POSITION_FLAG : 0) |
+        (position.IsAlongBaseLine() ? ALONG_BASE_LINE_FLAG : 0);
+    position_objects[index] = saved_object_indices[
+        positionsContainer_.GetObjectIndexForPosition(
+            first_position + index)];
+  }
+
+  // The edges to the fixed positions are left out with them.
+  std::vector<int> saved_edges;
+  std::vector<int> edge_offsets(1, 0);
+  for (int index = first_position; index < numberOfVertices_; ++index) {
+    for (int edge = edgeOffsets_[index]; edge < edgeOffsets_[index + 1];
+         ++edge) {
+      if (edgeTargets_[edge] >= first_position) {
+        saved_edges.push_back(edge);
+      }
+    }
+    edge_offsets.push_back(saved_edges.size());
+  }
+  int number_of_edges = saved_edges.size();
+  std::vector<int> edge_targets(number_of_edges);
+  std::vector<double> edge_costs(number_of_edges);
+  std::vector<int> begin_positions(number_of_edges);
+  std::vector<double> initial_distances(number_of_edges);
+  std::vector<double> final_distances(number_of_edges);
+  std::vector<double> turn_angles(number_of_edges);
+  std::vector<double> rotation_center_x(number_of_edges);
+  std::vector<double> rotation_center_y(number_of_edges);
+  std::vector<unsigned char> reversed(number_of_edges);
+  for (int index = 0; index < number_of_edges; ++index) {
+    int edge = saved_edges[index];
+    edge_targets[index] = edgeTargets_[edge] - first_position;
+    edge_costs[index] = edgeCosts_[edge];
+    begin_positions[index] = manuevers_.beginPositions[edge] - first_position;
+    initial_distances[index] =
+        manuevers_.initialStraightSectionDistances[edge];
+    final_distances[index] = manuevers_.finalStraightSectionDistances[edge];
+    turn_angles[index] = manuevers_.turnAngles[edge];
+    rotation_center_x[index] = manuevers_.rotationCenters[edge].x;
+    rotation_center_y[index] = manuevers_.rotationCenters[edge].y;
+    reversed[index] = manuevers_.reversed[edge];
+  }
+
+  GraphFileHeader header = GraphFileHeader();
+  std::copy(GRAPH_FILE_MAGIC, GRAPH_FILE_MAGIC + 8, header.magic);
+  header.version = GRAPH_FILE_VERSION;
+  header.byteOrder = GRAPH_FILE_BYTE_ORDER;
+  header.key = key;
+  header.numberOfPositions = number_of_positions;
+  header.numberOfObjects = number_of_objects;
+  header.numberOfEdges = number_of_edges;
+
+  std::ofstream out(file.c_str(), std::ios::out | std::ios::binary);
+  out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  utils::WriteArray(center_x, out);
+  utils::WriteArray(center_y, out);
+  utils::WriteArray(direction_x, out);
+  utils::WriteArray(direction_y, out);
+  utils::WriteArray(flags, out);
+  utils::WriteArray(position_objects, out);
+  utils::WriteArray(objects_in_file, out);
+  utils::WriteArray(object_position_offsets, out);
+  utils::WriteArray(object_positions, out);
+  utils::WriteArray(edge_offsets, out);
+  utils::WriteArray(edge_targets, out);
+  utils::WriteArray(edge_costs, out);
+  utils::WriteArray(begin_positions, out);
+  utils::WriteArray(initial_distances, out);
+  utils::WriteArray(final_distances, out);
+  utils::WriteArray(turn_angles, out);
+  utils::WriteArray(rotation_center_x, out);
+  utils::WriteArray(rotation_center_y, out);
+  utils::WriteArray(reversed, out);
+  if (!out) {
+    throw std::runtime_error("Could not write the graph to " + file);
+  }
+}
+
+void CarPositionsGraph::LoadFrozenGraph(
+    const std::string& file, unsigned long long key,
+    const std::vector<const geometry::RectangleObject*>& objects) {
+  utils::MappedFile mapped_file(file);
+  utils::BinaryFileReader reader(mapped_file, "The graph file is truncated.");
+  const GraphFileHeader& header = *reader.Read<GraphFileHeader>(1);
+  if (!std::equal(GRAPH_FILE_MAGIC, GRAPH_FILE_MAGIC + 8, header.magic) ||
+      header.byteOrder != GRAPH_FILE_BYTE_ORDER) {
+    throw std::runtime_error("The graph file has an unknown format.");
+  }
+  if (header.version != GRAPH_FILE_VERSION) {
+    throw std::runtime_error("The graph file was saved by another version.");
+  }
+  if (header.key != key) {
+    throw std::runtime_error("The graph file is for another graph.");
+  }
+
+  int number_of_positions = header.numberOfPositions;
+  int number_of_objects = header.numberOfObjects;
+  int number_of_edges = header.numberOfEdges;
+  if (number_of_positions < 0 || number_of_objects < 0 ||
+      number_of_edges < 0) {
+    throw std::runtime_error("The graph file is corrupted.");
+  }
+  const double* center_x = reader.Read<double>(number_of_positions);
+  const double* center_y = reader.Read<double>(number_of_positions);
+  const double* direction_x = reader.Read<double>(number_of_positions);
+  const double* direction_y = reader.Read<double>(number_of_positions);
+  const unsigned char* flags = reader.Read<unsigned char>(number_of_positions);
+  const unsigned* position_objects =
+      reader.Read<unsigned>(number_of_positions);
+  std::vector<int> objects_in_file;
+  reader.ReadArray(number_of_objects, &objects_in_file);
+  std::vector<int> object_position_offsets;
+  reader.ReadArray(number_of_objects + 1, &object_position_offsets);
+  std::vector<int> object_positions;
+  reader.ReadArray(object_position_offsets.back(), &object_positions);
+  std::vector<int> edge_offsets;
+  reader.ReadArray(number_of_positions + 1, &edge_offsets);
+  std::vector<int> edge_targets;
+  reader.ReadArray(number_of_edges, &edge_targets);
+  std::vector<double> edge_costs;
+  reader.ReadArray(number_of_edges, &edge_costs);
+  ManueverTable manuevers;
+  reader.ReadArray(number_of_edges, &manuevers.beginPositions);
+  reader.ReadArray(number_of_edges,
+                   &manuevers.initialStraightSectionDistances);
+  reader.ReadArray(number_of_edges, &manuevers.finalStraightSectionDistances);
+  reader.ReadArray(number_of_edges, &manuevers.turnAngles);
+  const double* rotation_center_x = reader.Read<double>(number_of_edges);
+  const double* rotation_center_y = reader.Read<double>(number_of_edges);
+  const unsigned char* reversed = reader.Read<unsigned char>(number_of_edges);
+  if (!reader.AtEnd()) {
+    throw std::runtime_error("The graph file is corrupted.");
+  }
+
+  CheckOffsets(object_position_offsets, number_of_positions);
+  CheckIndices(object_positions, number_of_positions);
+  CheckIndices(objects_in_file, objects.size());
+  CheckOffsets(edge_offsets, number_of_edges);
+  CheckIndices(edge_targets, number_of_positions);
+  CheckIndices(manuevers.beginPositions, number_of_positions);
+  for (int index = 0; index < number_of_positions; ++index) {
+    if (position_objects[index] >= static_cast<unsigned>(number_of_objects)) {
+      throw std::runtime_error("The graph file is corrupted.");
+    }
+  }
+
+  // The positions added so far keep their indices and their objects come
+  // first, as if the saved positions were added after them.
+  int first_position = positionsContainer_.GetNumberOfPositions();
+  int number_of_vertices = first_position + number_of_positions;
+  std::vector<CarPosition> positions(number_of_vertices);
+  std::vector<unsigned> all_position_objects(number_of_vertices);
+  std::vector<const geometry::RectangleObject*> container_objects;
+  std::vector<std::vector<int> > positions_for_objects;
+  std::map<const geometry::RectangleObject*, unsigned> object_indices;
+  for (unsigned index = 0;
+       index < positionsContainer_.GetNumberOfObjects(); ++index) {
+    container_objects.push_back(positionsContainer_.GetObject(index));
+    positions_for_objects.push_back(
+        positionsContainer_.GetCarPositionsForObject(index));
+    object_indices.insert(std::make_pair(container_objects.back(), index));
+  }
+  for (int index = 0; index < first_position; ++index) {
+    positions[index] = positionsContainer_.GetPosition(index);
+    all_position_objects[index] =
+        positionsContainer_.GetObjectIndexForPosition(index);
+  }
+
+  std::vector<unsigned> file_object_indices(number_of_objects);
+  for (int index = 0; index < number_of_objects; ++index) {
+    const geometry::RectangleObject* object = objects[objects_in_file[index]];
+    std::map<const geometry::RectangleObject*, unsigned>::iterator it =
+        object_indices.find(object);
+    if (it == object_indices.end()) {
+      it = object_indices.insert(
+          std::make_pair(object, container_objects.size())).first;
+      container_objects.push_back(object);
+      positions_for_objects.push_back(std::vector<int>());
+    }
+    file_object_indices[index] = it->second;
+    std::vector<int>& object_positions_list =
+        positions_for_objects[it->second];
+    for (int position = object_position_offsets[index];
+         position < object_position_offsets[index + 1]; ++position) {
+      object_positions_list.push_back(
+          first_position + object_positions[position]);
+    }
+  }
+  for (int index = 0; index < number_of_positions; ++index) {
+    CarPosition& position = positions[first_position + index];
+    position.SetCenter(geometry::Point(center_x[index], center_y[index]));
+    position.SetUnitDirection(
+        geometry::Vector(direction_x[index], direction_y[index]));
+    position.SetIsFinal((flags[index] & FINAL_POSITION_FLAG) != 0);
+    position.SetIsAlongBaseLine((flags[index] & ALONG_BASE_LINE_FLAG) != 0);
+    all_position_objects[first_position + index] =
+        file_object_indices[position_objects[index]];
+  }
+  positionsContainer_.Assign(positions, all_position_objects,
+                             container_objects, positions_for_objects);
+
+  // The added positions have no edges yet.
+  edge_offsets.insert(edge_offsets.begin(), first_position, 0);
+  for (int index = 0; index < number_of_edges; ++index) {
+    edge_targets[index] += first_position;
+    manuevers.beginPositions[index] += first_position;
+  }
+  manuevers.rotationCenters.resize(number_of_edges);
+  manuevers.reversed.resize(number_of_edges);
+  for (int index = 0; index < number_of_edges; ++index) {
+    manuevers.rotationCenters[index] =
+        geometry::Point(rotation_center_x[index], rotation_center_y[index]);
+    manuevers.reversed[index] = reversed[index] != 0;
+  }
+
+  numberOfVertices_ = number_of_vertices;
+  numberOfFixedPositions_ = first_position;
+  graph_.clear();
+  neighboursComputed_.assign(numberOfVertices_, true);
+  edgeOffsets_.swap(edge_offsets);
+  edgeTargets_.swap(edge_targets);
+  edgeCosts_.swap(edge_costs);
+  std::swap(manuevers_, manuevers);
+  frozen_ = true;
+  ConnectFixedPositions();
+}
+
+CarPosition CarPositionsGraph::GetPosition(int position_index) const {
+  return positionsContainer_.GetPosition(position_index);
+}
+
+geometry::Point CarPositionsGraph::GetPositionCenter(
+    int position_index) const {
+  return positionsContainer_.GetCenter(position_index);
+}
+
+const std::vector<GraphEdge>&
+    CarPositionsGraph::GetNeighbours(int position_index) {
+  if (frozen_) {
+    throw std::runtime_error(
+        "The neighbours of a frozen graph are accessed by edge index.");
+  }
+  if (!neighboursComputed_[position_index]) {
+    GetPositionNeighbours(position_index);
+    neighboursComputed_[position_index] = true;
+  }
+  return graph_[position_index];
+}
+
+void CarPositionsGraph::GetPositionNeighbours(int position_index) {
+  CarPosition car = positionsContainer_.GetPosition(position_index);
+  std::vector<int> candidates;
+  GetManueverCandidates(position_index, &candidates);
+  for (unsigned index = 0; index < candidates.size(); ++index) {
+    int other_index = candidates[index];
+    if (other_index == position_index) {
+      continue;
+    }
+    if (neighboursComputed_[other_index]) {
+      continue;
+    }
+    CarManuever manuever;
+    CarPosition car2 = positionsContainer_.GetPosition(other_index);
+
+    if (FindManuever(position_index, car, car2, &manuever,
+                     &movementContext_)) {
+      graph_[position_index].push_back(std::make_pair(other_index, manuever));
+
+      // Add the reversed manuever.
+      manuever.SetReversed(true);
+      graph_[other_index].push_back(std::make_pair(position_index, manuever));
+    } else if (FindManuever(other_index, car2, car, &manuever,
+                            &movementContext_)) {
+      graph_[other_index].push_back(std::make_pair(position_index, manuever));
+
+      // Add the reversed manuever.
+      manuever.SetReversed(true);
+      graph_[position_index].push_back(std::make_pair(other_index, manuever));
+    }
+  }
+}
+
+void CarPositionsGraph::GetManueverCandidates(
+    int position_index, std::vector<int>* candidates) const {
+  const std::vector<int>& touching_objects = neighbourhoodList_[
+      positionsContainer_.GetObjectIndexForPosition(position_index)];
+  geometry::Point center = positionsContainer_.GetCenter(position_index);
+  geometry::Vector direction = positionsContainer_.GetDirection(position_index);
+  const CarDescription& description = GetCarDescription();
+  double rear_axis_offset =
+      description.GetLength() * 0.5 * description.GetWheelAxisFraction();
+  geometry::Point rear_middle = center - direction * rear_axis_offset;
+  geometry::BoundingBox reach_box(
+      center.x - manueverReach_, center.x + manueverReach_,
+      center.y - manueverReach_, center.y + manueverReach_);
+  ManueverConeFilter filter(rear_middle, direction, rear_axis_offset);
+  std::vector<int> positions =
+      positionsContainer_.GetPositions(reach_box, filter);
+
+  candidates->clear();
+  for (unsigned index = 0; index < positions.size(); ++index) {
+    int other_index = positions[index];
+    int other_object = static_cast<int>(
+        positionsContainer_.GetObjectIndexForPosition(other_index));
+    if (!std::binary_search(touching_objects.begin(), touching_objects.end(),
+                            other_object)) {
+      continue;
+    }
+    geometry::Point other_center = positionsContainer_.GetCenter(other_index);
+    if (center.GetDistance(other_center) > manueverReach_) {
+      continue;
+    }
+    geometry::Vector other_direction =
+        positionsContainer_.GetDirection(other_index);
+    if (DoubleIsZero(direction.CrossProduct(other_direction))) {
+      if (IsParallelManueverImpossible(center, direction,
+                                       other_center, other_direction) &&
+          IsParallelManueverImpossible(other_center, other_direction,
+                                       center, direction)) {
+        continue;
+      }
+    } else if (IsOutsideManueverCones(
+        rear_middle, direction,
+        other_center - other_direction * rear_axis_offset, other_direction)) {
+      continue;
+    }
+    candidates->push_back(other_index);
+  }
+  std::sort(candidates->begin(), candidates->end());
+}
+
+bool CarPositionsGraph::FindManuever(
+    int position_index, const CarPosition& car, const CarPosition& car2,
+    CarManuever* manuever, CarMovementContext* movement_context) const {
+  if (manueverLibrary_ != NULL) {
+    const geometry::Vector& lattice_axis = objectAxes_[
+        positionsContainer_.GetObjectIndexForPosition(position_index)];
+    switch (manueverLibrary_->Lookup(car, car2, lattice_axis, manuever)) {
+      case ManueverLibrary::NO_MANUEVER:
+        return false;
+      case ManueverLibrary::MANUEVER_FOUND:
+        return movementHandler_->ManueverPossible(*manuever, car2,
+                                                  movement_context);
+      case ManueverLibrary::NOT_ON_LATTICE:
+        break;
+    }
+  }
+  return movementHandler_->SingleManueverBetweenStates(
+      car, car2, *manuever, movement_context);
+}
+
+void CarPositionsGraph::ComputeEdgesToFollowingPositions(
+    int position_index, CarMovementContext* movement_context,
+    std::vector<std::pair<int, GraphEdge> >* edges) const {
+  CarPosition car = positionsContainer_.GetPosition(position_index);
+  std::vector<int> candidates;
+  GetManueverCandidates(position_index, &candidates);
+  for (unsigned index = 0; index < candidates.size(); ++index) {
+    int other_index = candidates[index];
+    // Every pair is handled by the vertex with the smaller index, which is
+    // what the lazy computation does when vertices are visited in order.
+    if (other_index <= position_index) {
+      continue;
+    }
+    CarManuever manuever;
+    CarPosition car2 = positionsContainer_.GetPosition(other_index);
+
+    if (FindManuever(position_index, car, car2, &manuever,
+                     movement_context)) {
+      edges->push_back(std::make_pair(
+          position_index, std::make_pair(other_index, manuever)));
+
+      // Add the reversed manuever.
+      manuever.SetReversed(true);
+      edges->push_back(std::make_pair(
+          other_index, std::make_pair(position_index, manuever)));
+    } else if (FindManuever(other_index, car2, car, &manuever,
+                            movement_context)) {
+      edges->push_back(std::make_pair(
+          other_index, std::make_pair(position_index, manuever)));
+
+      // Add the reversed manuever.
+      manuever.SetReversed(true);
+      edges->push_back(std::make_pair(
+          position_index, std::make_pair(other_index, manuever)));
+    }
+  }
+}
+
+}  // namespace simulation
@@ -1,56 +1,216 @@
-#ifndef SIMUALTION_CAR_POSITIONS_GRAPH_H
-#define SIMUALTION_CAR_POSITIONS_GRAPH_H
-
-#include "simulation/car_description.h"
-#include "simulation/car_manuever.h"
-#include "simulation/car_positions_container.h"
-
-#include <vector>
-
-namespace geometry {
-class RectangleObject;
-}  // namespace geometry
-
-namespace simulation {
-
-class CarMovementHandler;
-class Car;
-class CarPosition;
-
-typedef std::pair<int, CarManuever> GraphEdge;
-
-class CarPositionsGraph {
- public:
-  CarPositionsGraph(const CarMovementHandler* movement_handler);
-
-  void AddPosition(const CarPosition& position,
-                   const geometry::RectangleObject* object);
-  void GetNeighbourhoodList(std::vector<std::vector<int> >& neighbour_list);
-  void FinalizeGraph();
-
-  const CarDescription& GetCarDescription() const;
-
-  // const std::vector<std::vector<GraphEdge> >& GetGraph() const;
-
-  bool IsPositionFinal(int position_index) const;
-
-  int GetNumberOfVertices() const;
-
-  const CarPosition* GetPosition(int position_index) const;
-
-  const std::vector<GraphEdge>& GetNeighbours(int position_index);
-
- private:
-  void GetPositionNeighbours(int position_index);
-
- private:
-  std::vector<std::vector<std::pair<int, CarManuever> > > graph_;
-  CarPositionsContainer positionsContainer_;
-  const CarMovementHandler* movementHandler_;
-
-  int numberOfVertices_;
-  std::vector<bool> neighboursComputed_;
-  std::vector<std::vector<int> > neighbourhoodList_;
-};
-}  // namespace simulation
-#endif // SIMUALTION_CAR_POSITIONS_GRAPH_H
+#ifndef SIMUALTION_CAR_POSITIONS_GRAPH_H
+#define SIMUALTION_CAR_POSITIONS_GRAPH_H
+
+#include "geometry/vector.h"
+#include "simulation/car_description.h"
+#include "simulation/car_manuever.h"
+#include "simulation/car_movement_handler.h"
+#include "simulation/car_positions_container.h"
+
+#include <string>
+#include <vector>
+
+namespace geometry {
+class RectangleObject;
+}  // namespace geometry
+
+namespace utils {
+class ThreadPool;
+}  // namespace utils
+
+namespace simulation {
+
+class Car;
+class CarPosition;
+class ManueverLibrary;
+
+typedef std::pair<int, CarManuever> GraphEdge;
+
+class CarPositionsGraph {
+ public:
+  CarPositionsGraph(const CarMovementHandler* movement_handler);
+
+  void AddPosition(const CarPosition& position,
+                   const geometry::RectangleObject* object);
+  void GetNeighbourhoodList(std::vector<std::vector<int> >& neighbour_list);
+
+  // FinalizeGraph renumbers the positions so that positions close in space
+  // and heading get close indices, which keeps the searches and the edges of
+  // neighbouring vertices close in memory. The positions with indices below
+  // "number_of_positions", such as the start positions of the routes, keep
+  // their indices. By default all positions are renumbered.
+  void SetNumberOfFixedPositions(int number_of_positions);
+  int GetNumberOfFixedPositions() const;
+
+  // If set, the manuevers between positions on the lattice of an object are
+  // taken from "library", which should be built for the car of the graph,
+  // and only checked for collisions. The other manuevers are still solved.
+  // The library is not owned by the graph and should be set before
+  // FinalizeGraph.
+  void SetManueverLibrary(const ManueverLibrary* library);
+  const ManueverLibrary* GetManueverLibrary() const;
+
+  // Positions are only connected if their centers are closer than
+  // "turning_diameters" diameters of the tightest turn of the car, 2.5 by
+  // default. A longer manuever is replaced by a chain of shorter ones through
+  // the positions in between, which may be longer or may not exist, so a
+  // bigger reach may find shorter routes at the cost of more candidates per
+  // position. Should be set before FinalizeGraph.
+  void SetManueverReach(double turning_diameters);
+
+  // The largest distance between the centers of two connected positions.
+  double GetManueverReach() const;
+
+  // The same for a graph of a car of "car_description" with the default
+  // reach.
+  static double GetDefaultManueverReach(const CarDescription& car_description);
+
+  void FinalizeGraph();
+
+  // Same as FinalizeGraph but also computes all the edges up front and
+  // freezes the graph. The vertices are handed out one by one to the threads
+  // of "thread_pool", each of which collects the edges it finds in a buffer
+  // of its own. The buffers are stitched together in vertex order, so the
+  // resulting graph does not depend on the number of threads. Pass NULL to
+  // compute everything on the calling thread.
+  void FinalizeGraphEagerly(utils::ThreadPool* thread_pool);
+
+  // A frozen graph keeps its edges in compressed sparse row form: the edges
+  // of a vertex occupy the interval [GetEdgesBegin, GetEdgesEnd) and only
+  // their targets and costs are stored next to each other. The manuevers are
+  // rebuilt from a separate table on demand. GetNeighbours may not be called
+  // for a frozen graph.
+  bool IsFrozen() const;
+  int GetEdgesBegin(int position_index) const;
+  int GetEdgesEnd(int position_index) const;
+  int GetEdgeTarget(int edge_index) const;
+  double GetEdgeCost(int edge_index) const;
+  CarManuever GetEdgeManuever(int edge_index) const;
+
+  const CarDescription& GetCarDescription() const;
+
+  // const std::vector<std::vector<GraphEdge> >& GetGraph() const;
+
+  bool IsPositionFinal(int position_index) const;
+
+  // Fills "objects" with all the objects that have at least one final
+  // position.
+  void GetFinalObjects(
+      std::vector<const geometry::RectangleObject*>* objects) const;
+
+  // Fills "positions" with the indices of the final positions on "object".
+  void GetFinalPositionsForObject(const geometry::RectangleObject* object,
+                                  std::vector<int>* positions) const;
+
+  int GetNumberOfVertices() const;
+
+  // Returns the number of positions added so far. Equals
+  // GetNumberOfVertices once the graph is finalized.
+  int GetNumberOfPositions() const;
+
+  // Saves a frozen graph to "file" tagged with "key". The fixed positions,
+  // such as the start positions of the routes, are left out together with
+  // their edges, so the file holds only the positions sampled on the layout
+  // and may be loaded for any start positions. The objects of the positions
+  // are stored as their indices in "objects", which should hold all of them.
+  void SaveFrozenGraph(
+      const std::string& file, unsigned long long key,
+      const std::vector<const geometry::RectangleObject*>& objects) const;
+
+  // Restores and freezes a graph saved by SaveFrozenGraph with the same
+  // "key" and "objects". The positions already added to the graph, such as
+  // the start positions of the routes, become its fixed positions and keep
+  // their indices, and the saved positions follow them. The file is mapped to
+  // memory and its arrays are copied to the graph as they are, so only the
+  // edges of the added positions are computed. The graph is the same as if
+  // it was built with FinalizeGraphEagerly. Throws std::runtime_error if the
+  // file is missing, was saved by another version or for another key.
+  void LoadFrozenGraph(
+      const std::string& file, unsigned long long key,
+      const std::vector<const geometry::RectangleObject*>& objects);
+
+  CarPosition GetPosition(int position_index) const;
+  geometry::Point GetPositionCenter(int position_index) const;
+
+  const std::vector<GraphEdge>& GetNeighbours(int position_index);
+
+ private:
+  friend class EdgesComputationTask;
+
+  // The parameters of the manuevers of a frozen graph stored column by
+  // column. "beginPositions" holds the index of the position the manuever
+  // starts from.
+  struct ManueverTable {
+    std::vector<int> beginPositions;
+    std::vector<double> initialStraightSectionDistances;
+    std::vector<double> finalStraightSectionDistances;
+    std::vector<double> turnAngles;
+    std::vector<geometry::Point> rotationCenters;
+    std::vector<bool> reversed;
+  };
+
+  void GetPositionNeighbours(int position_index);
+
+  // Computes what the search for the manuevers of a finalized graph needs:
+  // the reach, the touching objects and the axes of the objects.
+  void PrepareManueverSearch();
+
+  // Stores "edge" from "from" as the edge with index "edge_index" of a frozen
+  // graph.
+  void StoreEdge(int edge_index, int from, const GraphEdge& edge);
+
+  // Computes the edges of the fixed positions of a frozen graph and puts
+  // them in front of the edges of every vertex, where FinalizeGraphEagerly
+  // would put them.
+  void ConnectFixedPositions();
+
+  // Stores in "candidates" the positions a manuever from or to
+  // "position_index" is tried with: the ones on the touching objects which
+  // are within manueverReach_ of it and whose heading does not rule a
+  // manuever out. They are ordered by index, so the order of the edges does
+  // not depend on the order in which the objects got their first positions,
+  // which differs with the start positions.
+  void GetManueverCandidates(int position_index,
+                             std::vector<int>* candidates) const;
+
+  // Finds the manuever from "car", the position with index "position_index",
+  // to "car2" as CarMovementHandler::SingleManueverBetweenStates does. The
+  // manuever is taken from the manuever library if both positions are on the
+  // lattice of the object of "car".
+  bool FindManuever(int position_index, const CarPosition& car,
+                    const CarPosition& car2, CarManuever* manuever,
+                    CarMovementContext* movement_context) const;
+
+  // Computes the edges between "position_index" and all the candidates with
+  // bigger indices and appends them to "edges".
+  void ComputeEdgesToFollowingPositions(
+      int position_index, CarMovementContext* movement_context,
+      std::vector<std::pair<int, GraphEdge> >* edges) const;
+
+ private:
+  std::vector<std::vector<std::pair<int, CarManuever> > > graph_;
+  CarPositionsContainer positionsContainer_;
+  const CarMovementHandler* movementHandler_;
+  // Used by the edges computed lazily.
+  CarMovementContext movementContext_;
+
+  int numberOfVertices_;
+  int numberOfFixedPositions_;
+  double manueverReachInTurningDiameters_;
+  // GetManueverReach, computed when the graph is finalized.
+  double manueverReach_;
+  const ManueverLibrary* manueverLibrary_;
+  // The unit vectors along the axes of the objects, which are the axes of
+  // their lattices.
+  std::vector<geometry::Vector> objectAxes_;
+  std::vector<bool> neighboursComputed_;
+  std::vector<std::vector<int> > neighbourhoodList_;
+
+  bool frozen_;
+  std::vector<int> edgeOffsets_;
+  std::vector<int> edgeTargets_;
+  std::vector<double> edgeCosts_;
+  ManueverTable manuevers_;
+};
+}  // namespace simulation
+#endif // SIMUALTION_CAR_POSITIONS_GRAPH_H
@@ -1,88 +1,435 @@
-#include "simulation/car_positions_graph_router.h"
-
-#include "simulation/car.h"
-#include "simulation/car_manuever.h"
-#include "simulation/car_positions_graph.h"
-#include "utils/benchmark.h"
-#include "utils/double_utils.h"
-
-#include <algorithm>
-#include <queue>
-
-using namespace std;
-
-namespace simulation {
-CarPositionsGraphRouter::CarPositionsGraphRouter(
-    CarPositionsGraph *graph) : graph_(graph) {}
-
-std::vector<CarManuever> CarPositionsGraphRouter::GetRoute(
-    int from_index) const {
-  BENCHMARK_STR("Dijkstra time");
-  // const vector<vector<GraphEdge> >& graph = graph_->GetGraph();
-  int n = static_cast<int>(graph_->GetNumberOfVertices());
-
-  vector<double> dist(n, -1.0);
-  dist[from_index] = 0.0;
-
-  priority_queue<pair<double, int> > q;
-  q.push(make_pair(0, from_index));
-
-  vector<pair<int, int> > parent(n);
-  parent[from_index] = make_pair(from_index, 0);
-
-  vector<bool> visited(n, false);
-
-  int end_index = -1;
-  while (!q.empty()) {
-    int index = q.top().second;
-    double d = -q.top().first;
-    // std::cout << "Q size now: " << q.size() << endl;
-    q.pop();
-    if (visited[index]) {
-      continue;
-    }
-    const CarPosition* cp = graph_->GetPosition(index);
-    // std::cout << "Position: " << *cp << " distance: " << d << endl;
-
-    visited[index] = true;
-
-    // Found an end position - no need to continue searching.
-    if (graph_->IsPositionFinal(index)) {
-      end_index = index;
-      break;
-    }
-
-    const vector<GraphEdge>& neighbours = graph_->GetNeighbours(index);
-    for (unsigned i = 0; i < neighbours.size(); ++i) {
-      double new_dist = d + neighbours[i].second.GetTotalDistance();
-      int neighbour_index = neighbours[i].first;
-      if (visited[neighbour_index]) {
-        continue;
-      }
-      if (dist[neighbour_index] < 0 ||
-          DoubleIsGreater(dist[neighbour_index], new_dist)) {
-        parent[neighbour_index] = make_pair(index, i);
-        dist[neighbour_index] = new_dist;
-        q.push(make_pair(-dist[neighbour_index], neighbour_index));
-      }
-    }
-  }
-  vector<CarManuever> result;
-
-  // No route to end position found
-  if (end_index == -1) {
-    return result;
-  }
-  int current = end_index;
-  while (parent[current].first != current) {
-    const GraphEdge& edge =
-        graph_->GetNeighbours(parent[current].first)[parent[current].second];
-    result.push_back(edge.second);
-    current = parent[current].first;
-  }
-  reverse(result.begin(), result.end());
-
-  return result;
-}
-
-}  // namespace simulation
+#include "simulation/car_positions_graph_router.h"
+
+#include "geometry/rectangle_object.h"
+#include "simulation/car.h"
+#include "simulation/car_manuever.h"
+#include "simulation/car_positions_graph.h"
+#include "utils/benchmark.h"
+#include "utils/double_utils.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <limits>
+#include <stdexcept>
+
+using namespace std;
+
+namespace simulation {
+CarPositionsGraphRouter::CarPositionsGraphRouter(
+    CarPositionsGraph *graph)
+    : graph_(graph), searchAlgorithm_(DIJKSTRA),
+      numberOfExpandedVertices_(0), generation_(0),
+      finalObjectsComputed_(false), treeComputed_(false) {}
+
+void CarPositionsGraphRouter::SetSearchAlgorithm(
+    SearchAlgorithm search_algorithm) {
+  searchAlgorithm_ = search_algorithm;
+}
+
+int CarPositionsGraphRouter::GetNumberOfExpandedVertices() const {
+  return numberOfExpandedVertices_;
+}
+
+std::vector<CarManuever> CarPositionsGraphRouter::GetRoute(int from_index) {
+  BENCHMARK_STR("Dijkstra time");
+  vector<CarManuever> result;
+  if (treeComputed_) {
+    numberOfExpandedVertices_ = 0;
+    if (treeSuccessors_[from_index] == -1) {
+      return result;
+    }
+    for (int current = from_index; treeSuccessors_[current] != current;
+         current = treeSuccessors_[current]) {
+      int& edge = treeSuccessorEdges_[current];
+      if (edge == -1) {
+        edge = FindEdge(current, treeSuccessors_[current]);
+        if (edge == -1) {
+          throw std::runtime_error(
+              "The tree to the final positions does not match the graph.");
+        }
+      }
+      result.push_back(GetManuever(current, edge));
+    }
+    return result;
+  }
+
+  StartSearch();
+  bool guided = searchAlgorithm_ == A_STAR;
+  ReachVertex(&forward_, from_index, 0.0, from_index, 0,
+              guided ? GetDistanceToFinalLowerBound(from_index) : 0.0);
+  int end_index = RunSearch(&forward_, true, guided);
+
+  // No route to end position found
+  if (end_index == -1) {
+    return result;
+  }
+  int current = end_index;
+  while (forward_.parents[current].first != current) {
+    int previous = forward_.parents[current].first;
+    result.push_back(GetManuever(previous, forward_.parents[current].second));
+    current = previous;
+  }
+  reverse(result.begin(), result.end());
+
+  return result;
+}
+
+std::vector<CarManuever> CarPositionsGraphRouter::GetRouteToObject(
+    int from_index, const geometry::RectangleObject* object) {
+  BENCHMARK_STR("Bidirectional search time");
+  vector<CarManuever> result;
+  vector<int> targets;
+  graph_->GetFinalPositionsForObject(object, &targets);
+  StartSearch();
+  PrepareState(&backward_);
+  if (targets.empty()) {
+    return result;
+  }
+
+  ReachVertex(&forward_, from_index, 0.0, from_index, 0, 0.0);
+  for (unsigned i = 0; i < targets.size(); ++i) {
+    ReachVertex(&backward_, targets[i], 0.0, targets[i], 0, 0.0);
+  }
+
+  // The length of the shortest route found so far and the vertex where its
+  // forward and backward parts meet.
+  double best_distance = IsReached(backward_, from_index) ? 0.0 : -1.0;
+  int meeting_index = best_distance < 0.0 ? -1 : from_index;
+  while (true) {
+    double forward_priority = GetSmallestPriority(forward_);
+    double backward_priority = GetSmallestPriority(backward_);
+    if (forward_priority < 0.0 || backward_priority < 0.0) {
+      break;
+    }
+    if (meeting_index != -1 && DoubleIsGreaterOrEqual(
+        forward_priority + backward_priority, best_distance)) {
+      break;
+    }
+
+    // Grow the side with fewer vertices waiting.
+    bool forward = forward_.queue.size() <= backward_.queue.size();
+    SearchState* state = forward ? &forward_ : &backward_;
+    const SearchState& other = forward ? backward_ : forward_;
+    int index = PopVertex(state);
+    if (index == -1) {
+      continue;
+    }
+
+    int number_of_edges = GetNumberOfEdges(index);
+    for (int i = 0; i < number_of_edges; ++i) {
+      int neighbour_index;
+      double cost;
+      GetEdge(index, i, &neighbour_index, &cost);
+      if (state->visitedGeneration[neighbour_index] == generation_) {
+        continue;
+      }
+      double new_dist = state->distances[index] + cost;
+      if (!IsReached(*state, neighbour_index) ||
+          DoubleIsGreater(state->distances[neighbour_index], new_dist)) {
+        ReachVertex(state, neighbour_index, new_dist, index, i, 0.0);
+      }
+      if (IsReached(other, neighbour_index)) {
+        double distance = state->distances[neighbour_index] +
+            other.distances[neighbour_index];
+        if (meeting_index == -1 || distance < best_distance) {
+          best_distance = distance;
+          meeting_index = neighbour_index;
+        }
+      }
+    }
+  }
+
+  if (meeting_index == -1) {
+    return result;
+  }
+  int current = meeting_index;
+  while (forward_.parents[current].first != current) {
+    int previous = forward_.parents[current].first;
+    result.push_back(GetManuever(previous, forward_.parents[current].second));
+    current = previous;
+  }
+  reverse(result.begin(), result.end());
+
+  // The backward search went along the edges towards the meeting vertex.
+  // Route along the reversed ones which have the same costs.
+  current = meeting_index;
+  while (backward_.parents[current].first != current) {
+    int next = backward_.parents[current].first;
+    result.push_back(GetManuever(current, FindEdge(current, next)));
+    current = next;
+  }
+  return result;
+}
+
+void CarPositionsGraphRouter::ComputeTreeToFinalPositions() {
+  BENCHMARK_STR("Tree to final positions");
+  StartSearch();
+  int n = graph_->GetNumberOfVertices();
+  for (int index = 0; index < n; ++index) {
+    if (graph_->IsPositionFinal(index)) {
+      ReachVertex(&forward_, index, 0.0, index, 0, 0.0);
+    }
+  }
+  // There is no single source for the lower bound to guide.
+  RunSearch(&forward_, false, false);
+
+  treeDistances_.assign(n, -1.0);
+  treeSuccessors_.assign(n, -1);
+  treeSuccessorEdges_.assign(n, -1);
+  for (int index = 0; index < n; ++index) {
+    if (!IsReached(forward_, index)) {
+      continue;
+    }
+    int successor = forward_.parents[index].first;
+    treeDistances_[index] = forward_.distances[index];
+    treeSuccessors_[index] = successor;
+    if (successor == index) {
+      continue;
+    }
+
+    // The search went along the edge successor -> index. Route along the
+    // reversed one which has the same cost.
+    treeSuccessorEdges_[index] = FindEdge(index, successor);
+  }
+  treeComputed_ = true;
+}
+
+bool CarPositionsGraphRouter::HasTreeToFinalPositions() const {
+  return treeComputed_;
+}
+
+double CarPositionsGraphRouter::GetDistanceToFinal(int from_index) const {
+  if (!treeComputed_) {
+    throw std::runtime_error("The tree to the final positions is missing.");
+  }
+  return treeDistances_[from_index];
+}
+
+void CarPositionsGraphRouter::SaveTreeToFinalPositions(
+    std::ostream& out, unsigned long long key) const {
+  if (!treeComputed_) {
+    throw std::runtime_error("The tree to the final positions is missing.");
+  }
+  out << key << "\n";
+  out << treeSuccessors_.size() << "\n";
+  out << setprecision(numeric_limits<double>::digits10 + 2);
+  for (unsigned index = 0; index < treeSuccessors_.size(); ++index) {
+    out << treeDistances_[index] << " " << treeSuccessors_[index] << "\n";
+  }
+}
+
+void CarPositionsGraphRouter::LoadTreeToFinalPositions(
+    std::istream& in, unsigned long long key) {
+  unsigned long long key_in_file;
+  if (!(in >> key_in_file) || key_in_file != key) {
+    throw std::runtime_error(
+        "The tree to the final positions is for another graph.");
+  }
+
+  int n = graph_->GetNumberOfVertices();
+  int number_of_vertices;
+  if (!(in >> number_of_vertices) || number_of_vertices != n) {
+    throw std::runtime_error(
+        "The tree to the final positions is for another graph.");
+  }
+
+  vector<double> distances(n);
+  vector<int> successors(n);
+  for (int index = 0; index < n; ++index) {
+    if (!(in >> distances[index] >> successors[index])) {
+      throw std::runtime_error(
+          "The tree to the final positions is truncated.");
+    }
+    int successor = successors[index];
+    if (successor < -1 || successor >= n ||
+        (successor == index) != graph_->IsPositionFinal(index)) {
+      throw std::runtime_error(
+          "The tree to the final positions is for another graph.");
+    }
+  }
+
+  // Make sure the buffers match the graph before the tree is marked valid.
+  StartSearch();
+  treeDistances_.swap(distances);
+  treeSuccessors_.swap(successors);
+  treeSuccessorEdges_.assign(n, -1);
+  treeComputed_ = true;
+}
+
+void CarPositionsGraphRouter::StartSearch() {
+  unsigned n = static_cast<unsigned>(graph_->GetNumberOfVertices());
+  if (lowerBounds_.size() != n) {
+    lowerBounds_.assign(n, -1.0);
+    finalObjectsComputed_ = false;
+    treeComputed_ = false;
+  }
+  numberOfExpandedVertices_ = 0;
+
+  ++generation_;
+  // Stamps from before the counter wrapped around would look current.
+  if (generation_ == 0) {
+    forward_.reachedGeneration.assign(forward_.reachedGeneration.size(), 0);
+    forward_.visitedGeneration.assign(forward_.visitedGeneration.size(), 0);
+    backward_.reachedGeneration.assign(backward_.reachedGeneration.size(), 0);
+    backward_.visitedGeneration.assign(backward_.visitedGeneration.size(), 0);
+    generation_ = 1;
+  }
+  PrepareState(&forward_);
+}
+
+void CarPositionsGraphRouter::PrepareState(SearchState* state) {
+  unsigned n = static_cast<unsigned>(graph_->GetNumberOfVertices());
+  if (state->reachedGeneration.size() != n) {
+    state->reachedGeneration.assign(n, 0);
+    state->visitedGeneration.assign(n, 0);
+    state->distances.resize(n);
+    state->parents.resize(n);
+  }
+  state->queue.clear();
+}
+
+int CarPositionsGraphRouter::RunSearch(SearchState* state, bool stop_at_final,
+                                       bool guided) {
+  while (true) {
+    int index = PopVertex(state);
+    if (index == -1) {
+      break;
+    }
+    double d = state->distances[index];
+
+    // Found an end position - no need to continue searching.
+    if (stop_at_final && graph_->IsPositionFinal(index)) {
+      return index;
+    }
+
+    int number_of_edges = GetNumberOfEdges(index);
+    for (int i = 0; i < number_of_edges; ++i) {
+      int neighbour_index;
+      double cost;
+      GetEdge(index, i, &neighbour_index, &cost);
+      if (state->visitedGeneration[neighbour_index] == generation_) {
+        continue;
+      }
+      double new_dist = d + cost;
+      if (!IsReached(*state, neighbour_index) ||
+          DoubleIsGreater(state->distances[neighbour_index], new_dist)) {
+        ReachVertex(state, neighbour_index, new_dist, index, i,
+                    guided ? GetDistanceToFinalLowerBound(neighbour_index)
+                           : 0.0);
+      }
+    }
+  }
+  return -1;
+}
+
+int CarPositionsGraphRouter::PopVertex(SearchState* state) {
+  vector<pair<double, int> >& queue = state->queue;
+  while (!queue.empty()) {
+    pop_heap(queue.begin(), queue.end());
+    int index = queue.back().second;
+    queue.pop_back();
+    if (state->visitedGeneration[index] != generation_) {
+      state->visitedGeneration[index] = generation_;
+      ++numberOfExpandedVertices_;
+      return index;
+    }
+  }
+  return -1;
+}
+
+double CarPositionsGraphRouter::GetSmallestPriority(
+    const SearchState& state) const {
+  if (state.queue.empty()) {
+    return -1.0;
+  }
+  return -state.queue.front().first;
+}
+
+void CarPositionsGraphRouter::ReachVertex(SearchState* state, int index,
+                                          double distance, int parent,
+                                          int edge, double lower_bound) {
+  state->reachedGeneration[index] = generation_;
+  state->distances[index] = distance;
+  state->parents[index] = make_pair(parent, edge);
+  state->queue.push_back(make_pair(-(distance + lower_bound), index));
+  push_heap(state->queue.begin(), state->queue.end());
+}
+
+bool CarPositionsGraphRouter::IsReached(const SearchState& state,
+                                        int index) const {
+  return state.reachedGeneration[index] == generation_;
+}
+
+int CarPositionsGraphRouter::GetNumberOfEdges(int position_index) {
+  if (graph_->IsFrozen()) {
+    return graph_->GetEdgesEnd(position_index) -
+        graph_->GetEdgesBegin(position_index);
+  }
+  return static_cast<int>(graph_->GetNeighbours(position_index).size());
+}
+
+void CarPositionsGraphRouter::GetEdge(int position_index, int edge,
+                                      int* target, double* cost) {
+  // A frozen graph is read only through its targets and costs arrays.
+  if (graph_->IsFrozen()) {
+    int edge_index = graph_->GetEdgesBegin(position_index) + edge;
+    *target = graph_->GetEdgeTarget(edge_index);
+    *cost = graph_->GetEdgeCost(edge_index);
+  } else {
+    const GraphEdge& graph_edge = graph_->GetNeighbours(position_index)[edge];
+    *target = graph_edge.first;
+    *cost = graph_edge.second.GetTotalDistance();
+  }
+}
+
+CarManuever CarPositionsGraphRouter::GetManuever(int position_index,
+                                                 int edge) {
+  if (graph_->IsFrozen()) {
+    return graph_->GetEdgeManuever(
+        graph_->GetEdgesBegin(position_index) + edge);
+  }
+  return graph_->GetNeighbours(position_index)[edge].second;
+}
+
+int CarPositionsGraphRouter::FindEdge(int from_index, int to_index) {
+  int result = -1;
+  double best_cost = 0.0;
+  int edges = GetNumberOfEdges(from_index);
+  for (int edge = 0; edge < edges; ++edge) {
+    int target;
+    double cost;
+    GetEdge(from_index, edge, &target, &cost);
+    if (target == to_index && (result == -1 || cost < best_cost)) {
+      best_cost = cost;
+      result = edge;
+    }
+  }
+  return result;
+}
+
+double CarPositionsGraphRouter::GetDistanceToFinalLowerBound(
+    int position_index) {
+  if (searchAlgorithm_ != A_STAR) {
+    return 0.0;
+  }
+  if (!finalObjectsComputed_) {
+    graph_->GetFinalObjects(&finalObjects_);
+    finalObjectsComputed_ = true;
+  }
+  double& lower_bound = lowerBounds_[position_index];
+  if (lower_bound >= 0.0) {
+    return lower_bound;
+  }
+
+  geometry::Point center = graph_->GetPositionCenter(position_index);
+  lower_bound = finalObjects_.empty() ? 0.0 : -1.0;
+  for (unsigned i = 0; i < finalObjects_.size(); ++i) {
+    double distance = finalObjects_[i]->GetDistanceToPoint(center);
+    if (lower_bound < 0.0 || distance < lower_bound) {
+      lower_bound = distance;
+    }
+  }
+  return lower_bound;
+}
+
+}  // namespace simulation
@@ -1,23 +1,165 @@
-#ifndef SIMULATION_CAR_POSITIONS_GRAPH_ROUTER_H
-#define SIMULATION_CAR_POSITIONS_GRAPH_ROUTER_H
-
-#include <vector>
-
-namespace simulation {
-
-class CarPositionsGraph;
-class CarManuever;
-class Car;
-
-class CarPositionsGraphRouter {
- public:
-  CarPositionsGraphRouter(CarPositionsGraph* graph);
-
-  std::vector<CarManuever> GetRoute(int from_index) const;
-
- private:
-  CarPositionsGraph* graph_;
-};
-
-}  // namespace simulation
-#endif // SIMULATION_CAR_POSITIONS_GRAPH_ROUTER_H
+#ifndef SIMULATION_CAR_POSITIONS_GRAPH_ROUTER_H
+#define SIMULATION_CAR_POSITIONS_GRAPH_ROUTER_H
+
+#include <iostream>
+#include <utility>
+#include <vector>
+
+namespace geometry {
+class RectangleObject;
+}  // namespace geometry
+
+namespace simulation {
+
+class CarPositionsGraph;
+class CarManuever;
+class Car;
+
+// Finds routes in a CarPositionsGraph. A router is meant to answer many
+// queries on the same graph: its search buffers are allocated once and
+// invalidated between searches by bumping a generation counter instead of
+// being refilled.
+class CarPositionsGraphRouter {
+ public:
+  enum SearchAlgorithm {
+    DIJKSTRA,
+    // Dijkstra guided by a lower bound of the distance to the closest final
+    // position. Finds routes with the same length as DIJKSTRA while
+    // expanding fewer vertices.
+    A_STAR
+  };
+
+ public:
+  CarPositionsGraphRouter(CarPositionsGraph* graph);
+
+  void SetSearchAlgorithm(SearchAlgorithm search_algorithm);
+
+  // Returns the shortest route from the given position to a final one or an
+  // empty route if there is none. Once ComputeTreeToFinalPositions has been
+  // called the route is read from the tree without a new search.
+  std::vector<CarManuever> GetRoute(int from_index);
+
+  // Returns the shortest route from the given position to a final position
+  // of "object" or an empty route if there is none. Runs a bidirectional
+  // search: a forward one from the start and a backward one from all the
+  // final positions of the object, which can go along the outgoing edges as
+  // every manuever comes together with its reversed one. The search stops
+  // once the shortest route through a vertex reached by both sides is not
+  // longer than the sum of the smallest distances left in the two queues.
+  std::vector<CarManuever> GetRouteToObject(
+      int from_index, const geometry::RectangleObject* object);
+
+  // @return - the number of vertices expanded by the last search.
+  int GetNumberOfExpandedVertices() const;
+
+  // Runs a single search from all the final positions at once and keeps the
+  // resulting shortest path tree. This explores the whole graph, so it pays
+  // off only when many routes are needed on the same graph. Every manuever
+  // in the graph comes together with its reversed one, so the tree built
+  // along the outgoing edges also gives the shortest routes towards the
+  // final positions.
+  void ComputeTreeToFinalPositions();
+  bool HasTreeToFinalPositions() const;
+
+  // @return - the length of the shortest route from the given position to a
+  //     final one or -1 if there is none. Read from the tree to the final
+  //     positions which should be computed or loaded beforehand.
+  double GetDistanceToFinal(int from_index) const;
+
+  // Writes the distance to a final position and the next vertex on the route
+  // of every vertex, so the tree can be restored for the same graph without
+  // a search. The tree is tagged with "key", which should identify the
+  // graph, e.g. CarPositionsGraphBuilder::GetGraphKey.
+  void SaveTreeToFinalPositions(std::ostream& out,
+                                unsigned long long key) const;
+
+  // Reads a tree written by SaveTreeToFinalPositions with the same "key".
+  // Throws std::runtime_error if the key differs or the tree does not match
+  // the graph.
+  void LoadTreeToFinalPositions(std::istream& in, unsigned long long key);
+
+ private:
+  // The state of a search in one direction. The distance and the parent of
+  // a vertex are valid only if its reached generation equals generation_.
+  struct SearchState {
+    std::vector<unsigned> reachedGeneration;
+    std::vector<unsigned> visitedGeneration;
+    std::vector<double> distances;
+    // The vertex the search came from and the index of its edge.
+    std::vector<std::pair<int, int> > parents;
+    // A max heap of the negated priorities.
+    std::vector<std::pair<double, int> > queue;
+  };
+
+ private:
+  // Resizes the buffers if the graph has grown and invalidates the results
+  // of the previous search in both directions.
+  void StartSearch();
+  void PrepareState(SearchState* state);
+
+  // Runs the search from the vertices already pushed to the queue. Returns
+  // the first final position reached if "stop_at_final" is set and -1
+  // otherwise. If "guided" is set the vertices are prioritized by their
+  // distance plus the lower bound of the distance left.
+  int RunSearch(SearchState* state, bool stop_at_final, bool guided);
+
+  // Pops the vertex with the smallest priority that is not visited yet,
+  // marks it visited and returns it or returns -1 if there is none.
+  int PopVertex(SearchState* state);
+
+  // Returns the smallest priority in the queue of "state" or -1 if it is
+  // empty.
+  double GetSmallestPriority(const SearchState& state) const;
+
+  // Records that "index" can be reached at "distance" via the edge with
+  // index "edge" of "parent" and pushes it to the queue with priority
+  // "distance" + "lower_bound".
+  void ReachVertex(SearchState* state, int index, double distance,
+                   int parent, int edge, double lower_bound);
+
+  bool IsReached(const SearchState& state, int index) const;
+
+  // Uniform access to the edges of frozen and lazily built graphs. "edge"
+  // is the index of the edge among the edges of the vertex.
+  int GetNumberOfEdges(int position_index);
+  void GetEdge(int position_index, int edge, int* target, double* cost);
+  CarManuever GetManuever(int position_index, int edge);
+
+  // Returns the cheapest edge from "from_index" to "to_index" or -1.
+  int FindEdge(int from_index, int to_index);
+
+  // Returns a lower bound of the distance the car should travel from the
+  // given position to a final one: the euclidean distance from its center to
+  // the closest object having final positions. No edge is shorter than the
+  // distance between the centers of its ends so the bound is consistent.
+  // Zero unless the search algorithm is A_STAR.
+  double GetDistanceToFinalLowerBound(int position_index);
+
+ private:
+  CarPositionsGraph* graph_;
+  SearchAlgorithm searchAlgorithm_;
+  int numberOfExpandedVertices_;
+
+  unsigned generation_;
+  SearchState forward_;
+  // Used only by the bidirectional search.
+  SearchState backward_;
+
+  // Depend only on the graph so they are kept between searches.
+  bool finalObjectsComputed_;
+  std::vector<const geometry::RectangleObject*> finalObjects_;
+  std::vector<double> lowerBounds_;
+
+  // The shortest path tree towards the final positions. For every vertex
+  // the next vertex on its route and the index of the edge leading to it.
+  // Final positions are their own successors and -1 marks vertices with no
+  // route. The edges of a loaded tree are looked up when first needed, as the
+  // order of the edges of a lazily built graph is not fixed.
+  bool treeComputed_;
+  std::vector<double> treeDistances_;
+  std::vector<int> treeSuccessors_;
+  std::vector<int> treeSuccessorEdges_;
+};
+
+}  // namespace simulation
+#endif // SIMULATION_CAR_POSITIONS_GRAPH_ROUTER_H
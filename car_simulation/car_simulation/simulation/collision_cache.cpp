@@ -0,0 +1,132 @@
+#include "simulation/collision_cache.h"
+
+#include "geometry/point.h"
+#include "geometry/vector.h"
+#include "simulation/car_position.h"
+
+#include <cmath>
+#include <mutex>
+#include <vector>
+
+namespace simulation {
+
+// The side of the cells the start positions are quantised to in meters.
+static const double POSITION_QUANTUM = 1.0;
+// The components of the unit direction are quantised to steps of
+// 1 / DIRECTION_STEPS.
+static const double DIRECTION_STEPS = 8.0;
+
+static const int NUMBER_OF_SHARDS = 16;
+static const int SETS_PER_SHARD = 128;
+static const int WAYS = 4;
+
+CollisionCache::CollisionCache()
+    : shards_(NUMBER_OF_SHARDS), hits_(0), misses_(0), insertions_(0),
+      evictions_(0) {
+  for (int index = 0; index < NUMBER_OF_SHARDS; ++index) {
+    shards_[index].entries.resize(SETS_PER_SHARD * WAYS);
+    shards_[index].hands.resize(SETS_PER_SHARD, 0);
+  }
+}
+
+// static
+unsigned long long CollisionCache::GetKey(const CarPosition& position) {
+  const geometry::Point& center = position.GetCenter();
+  geometry::Vector direction = position.GetDirection().Unit();
+  // 24 bits for each coordinate of the cell and 8 bits for each component
+  // of the direction.
+  unsigned long long x = static_cast<long long>(
+      floor(center.x / POSITION_QUANTUM)) & 0xffffff;
+  unsigned long long y = static_cast<long long>(
+      floor(center.y / POSITION_QUANTUM)) & 0xffffff;
+  unsigned long long dx = static_cast<long long>(
+      floor(direction.x * DIRECTION_STEPS)) & 0xff;
+  unsigned long long dy = static_cast<long long>(
+      floor(direction.y * DIRECTION_STEPS)) & 0xff;
+  return (x << 40) | (y << 16) | (dx << 8) | dy;
+}
+
+CollisionCache::Shard& CollisionCache::GetSet(unsigned long long key,
+                                              int* first_entry) {
+  // Mixes the bits of the key so that neighbouring cells spread over the
+  // shards and the sets.
+  unsigned long long hash = key;
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53ULL;
+  hash ^= hash >> 33;
+  *first_entry = static_cast<int>((hash / NUMBER_OF_SHARDS) % SETS_PER_SHARD) *
+      WAYS;
+  return shards_[hash % NUMBER_OF_SHARDS];
+}
+
+bool CollisionCache::Lookup(unsigned long long key,
+                            geometry::Segment* segment) {
+  int first_entry;
+  Shard& shard = GetSet(key, &first_entry);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  for (int way = 0; way < WAYS; ++way) {
+    Entry& entry = shard.entries[first_entry + way];
+    if (entry.valid && entry.key == key) {
+      entry.referenced = true;
+      *segment = entry.segment;
+      return true;
+    }
+  }
+  return false;
+}
+
+void CollisionCache::Insert(unsigned long long key,
+                            const geometry::Segment& segment) {
+  int first_entry;
+  Shard& shard = GetSet(key, &first_entry);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  ++insertions_;
+  for (int way = 0; way < WAYS; ++way) {
+    Entry& entry = shard.entries[first_entry + way];
+    if (entry.valid && entry.key == key) {
+      entry.referenced = true;
+      entry.segment = segment;
+      return;
+    }
+  }
+
+  // The hand skips the referenced entries, giving them a second chance.
+  unsigned char& hand = shard.hands[first_entry / WAYS];
+  while (true) {
+    Entry& entry = shard.entries[first_entry + hand];
+    hand = (hand + 1) % WAYS;
+    if (entry.valid && entry.referenced) {
+      entry.referenced = false;
+      continue;
+    }
+    if (entry.valid) {
+      ++evictions_;
+    }
+    entry.key = key;
+    entry.valid = true;
+    entry.referenced = false;
+    entry.segment = segment;
+    return;
+  }
+}
+
+void CollisionCache::RecordHit() {
+  ++hits_;
+}
+
+void CollisionCache::RecordMiss() {
+  ++misses_;
+}
+
+CollisionCache::Stats CollisionCache::GetStats() const {
+  Stats stats;
+  stats.hits = hits_;
+  stats.misses = misses_;
+  stats.insertions = insertions_;
+  stats.evictions = evictions_;
+  return stats;
+}
+
+}  // namespace simulation
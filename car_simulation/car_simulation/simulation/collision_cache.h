@@ -0,0 +1,93 @@
+#ifndef SIMULATION_COLLISION_CACHE_H_
+#define SIMULATION_COLLISION_CACHE_H_
+
+#include "geometry/segment.h"
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace simulation {
+
+class CarPosition;
+
+// Remembers the boundary segments which blocked straight movements of the
+// car. The start positions are quantised to square cells and to a number of
+// headings, and each key keeps the last segment found to block a movement
+// starting there. The length of the movement is not part of the key, so
+// movements of different lengths from nearby positions share their blockers.
+// A cached segment is only a candidate: the caller checks it exactly before
+// relying on it, so the cache never changes the outcome of a query, only how
+// quickly a blocked movement is rejected.
+//
+// The cache has a fixed number of entries. Each key maps to a small set of
+// entries and the entry to replace is chosen with the CLOCK policy. Lookups
+// and insertions may be done from several threads at once.
+class CollisionCache {
+ public:
+  struct Stats {
+    Stats() : hits(0), misses(0), insertions(0), evictions(0) {}
+
+    // Queries answered by a cached segment.
+    unsigned long long hits;
+    // Queries for which no cached segment blocked the movement.
+    unsigned long long misses;
+    unsigned long long insertions;
+    // Insertions which replaced the segment of another key.
+    unsigned long long evictions;
+  };
+
+ public:
+  CollisionCache();
+
+  // Returns the key of the movements starting at "position".
+  static unsigned long long GetKey(const CarPosition& position);
+
+  // Copies the segment cached for "key" to "segment" and returns true if
+  // there is one.
+  bool Lookup(unsigned long long key, geometry::Segment* segment);
+
+  // Caches "segment" as the blocking segment for "key".
+  void Insert(unsigned long long key, const geometry::Segment& segment);
+
+  // Should be called once per query to keep the statistics.
+  void RecordHit();
+  void RecordMiss();
+
+  Stats GetStats() const;
+
+ private:
+  struct Entry {
+    Entry() : key(0), valid(false), referenced(false) {}
+
+    unsigned long long key;
+    bool valid;
+    bool referenced;
+    geometry::Segment segment;
+  };
+
+  // A group of sets guarded by one mutex, so that threads working with
+  // different shards do not wait for each other.
+  struct Shard {
+    std::mutex mutex;
+    std::vector<Entry> entries;
+    // The CLOCK hand of every set.
+    std::vector<unsigned char> hands;
+  };
+
+ private:
+  // Returns the shard and the first entry of the set of "key".
+  Shard& GetSet(unsigned long long key, int* first_entry);
+
+ private:
+  std::vector<Shard> shards_;
+
+  std::atomic<unsigned long long> hits_;
+  std::atomic<unsigned long long> misses_;
+  std::atomic<unsigned long long> insertions_;
+  std::atomic<unsigned long long> evictions_;
+};
+
+}  // namespace simulation
+
+#endif  // SIMULATION_COLLISION_CACHE_H_
@@ -0,0 +1,274 @@
+#include "simulation/manuever_library.h"
+
+#include "geometry/geometry_utils.h"
+#include "geometry/point.h"
+#include "geometry/vector.h"
+#include "simulation/car_manuever.h"
+#include "simulation/car_movement_handler.h"
+#include "simulation/car_position.h"
+#include "simulation/car_positions_graph.h"
+#include "utils/binary_file.h"
+#include "utils/double_utils.h"
+#include "utils/mapped_file.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace simulation {
+
+// Positions farther than this from the lattice, in lattice steps or heading
+// steps, are not on it.
+static const double LATTICE_TOLERANCE = 1e-6;
+
+// A saved library starts with a LibraryFileHeader followed by the arrays of
+// the library, written as described in utils/binary_file.h.
+static const char LIBRARY_FILE_MAGIC[8] =
+    {'C', 'M', 'A', 'N', 'V', 'L', 'I', 0};
+// Should be increased on every change of the format or of the way the
+// manuevers are solved.
+static const unsigned LIBRARY_FILE_VERSION = 1;
+static const unsigned LIBRARY_FILE_BYTE_ORDER = 0x01020304;
+
+// The header is written and read in place, so its fields are ordered to be
+// aligned without any padding of the compiler and it takes 64 bytes on every
+// platform.
+struct LibraryFileHeader {
+  char magic[8];
+  unsigned version;
+  unsigned byteOrder;
+  double width;
+  double length;
+  double maxSteeringAngle;
+  double latticeStep;
+  int numberOfHeadings;
+  int maxOffset;
+  int numberOfManuevers;
+  int padding;
+};
+typedef char LibraryFileHeaderSizeCheck[
+    sizeof(LibraryFileHeader) == 64 ? 1 : -1];
+
+// Returns the multiple of "step" closest to "value" in steps, or sets
+// "on_lattice" to false if "value" is not close enough to one.
+static int GetLatticeIndex(double value, double step, bool* on_lattice) {
+  double steps = value / step;
+  double index = floor(steps + 0.5);
+  if (fabs(steps - index) > LATTICE_TOLERANCE) {
+    *on_lattice = false;
+  }
+  return static_cast<int>(index);
+}
+
+ManueverLibrary::ManueverLibrary(const CarDescription& car_description,
+                                 double lattice_step, int number_of_headings)
+  : carDescription_(car_description),
+    latticeStep_(lattice_step),
+    numberOfHeadings_(number_of_headings),
+    maxOffset_(static_cast<int>(ceil(
+        CarPositionsGraph::GetDefaultManueverReach(car_description) /
+        lattice_step))) {}
+
+int ManueverLibrary::GetNumberOfEntries() const {
+  int side = 2 * maxOffset_ + 1;
+  return numberOfHeadings_ * numberOfHeadings_ * side * side;
+}
+
+int ManueverLibrary::GetEntryIndex(int from_heading, int to_heading,
+                                   int offset_x, int offset_y) const {
+  int side = 2 * maxOffset_ + 1;
+  return ((from_heading * numberOfHeadings_ + to_heading) * side +
+          offset_y + maxOffset_) * side + offset_x + maxOffset_;
+}
+
+void ManueverLibrary::Build() {
+  // Without obstacles only the geometry of the manuevers is solved.
+  CarMovementHandler movement_handler(NULL, carDescription_);
+  CarMovementContext context;
+  double heading_step = 2.0 * geometry::GeometryUtils::PI / numberOfHeadings_;
+
+  manueverIndices_.assign(GetNumberOfEntries(), -1);
+  initialStraightSectionDistances_.clear();
+  finalStraightSectionDistances_.clear();
+  turnAngles_.clear();
+  rotationCenterX_.clear();
+  rotationCenterY_.clear();
+  for (int from_heading = 0; from_heading < numberOfHeadings_;
+       ++from_heading) {
+    CarPosition from;
+    from.SetDirection(geometry::Vector(1, 0).Rotate(
+        from_heading * heading_step));
+    for (int to_heading = 0; to_heading < numberOfHeadings_; ++to_heading) {
+      CarPosition to;
+      to.SetDirection(geometry::Vector(1, 0).Rotate(
+          to_heading * heading_step));
+      for (int offset_y = -maxOffset_; offset_y <= maxOffset_; ++offset_y) {
+        for (int offset_x = -maxOffset_; offset_x <= maxOffset_;
+             ++offset_x) {
+          to.SetCenter(geometry::Point(offset_x * latticeStep_,
+                                       offset_y * latticeStep_));
+          CarManuever manuever;
+          if (!movement_handler.SingleManueverBetweenStates(
+              from, to, manuever, &context)) {
+            continue;
+          }
+          manueverIndices_[GetEntryIndex(from_heading, to_heading,
+                                         offset_x, offset_y)] =
+              turnAngles_.size();
+          initialStraightSectionDistances_.push_back(
+              manuever.GetInitialStraightSectionDistance());
+          finalStraightSectionDistances_.push_back(
+              manuever.GetFinalStraightSectionDistance());
+          turnAngles_.push_back(manuever.GetTurnAngle());
+          rotationCenterX_.push_back(manuever.GetRotationCenter().x);
+          rotationCenterY_.push_back(manuever.GetRotationCenter().y);
+        }
+      }
+    }
+  }
+}
+
+std::string ManueverLibrary::GetFileName() const {
+  double parameters[] = {
+    carDescription_.GetWidth(), carDescription_.GetLength(),
+    carDescription_.GetMaxSteeringAngle(), latticeStep_
+  };
+  unsigned long long hash = utils::HashBytes(parameters, sizeof(parameters),
+                                             utils::HASH_OFFSET_BASIS);
+  hash = utils::HashBytes(&numberOfHeadings_, sizeof(numberOfHeadings_), hash);
+  hash = utils::HashBytes(&maxOffset_, sizeof(maxOffset_), hash);
+  std::ostringstream name;
+  name << "manuevers_" << std::hex << std::setw(16) << std::setfill('0')
+       << hash << ".bin";
+  return name.str();
+}
+
+void ManueverLibrary::Save(const std::string& file) const {
+  LibraryFileHeader header = LibraryFileHeader();
+  std::copy(LIBRARY_FILE_MAGIC, LIBRARY_FILE_MAGIC + 8, header.magic);
+  header.version = LIBRARY_FILE_VERSION;
+  header.byteOrder = LIBRARY_FILE_BYTE_ORDER;
+  header.width = carDescription_.GetWidth();
+  header.length = carDescription_.GetLength();
+  header.maxSteeringAngle = carDescription_.GetMaxSteeringAngle();
+  header.latticeStep = latticeStep_;
+  header.numberOfHeadings = numberOfHeadings_;
+  header.maxOffset = maxOffset_;
+  header.numberOfManuevers = GetNumberOfManuevers();
+
+  std::ofstream out(file.c_str(), std::ios::out | std::ios::binary);
+  out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  utils::WriteArray(manueverIndices_, out);
+  utils::WriteArray(initialStraightSectionDistances_, out);
+  utils::WriteArray(finalStraightSectionDistances_, out);
+  utils::WriteArray(turnAngles_, out);
+  utils::WriteArray(rotationCenterX_, out);
+  utils::WriteArray(rotationCenterY_, out);
+  if (!out) {
+    throw std::runtime_error("Could not write the manuever library to " +
+                             file);
+  }
+}
+
+void ManueverLibrary::Load(const std::string& file) {
+  utils::MappedFile mapped_file(file);
+  utils::BinaryFileReader reader(mapped_file,
+                                 "The manuever library file is truncated.");
+  const LibraryFileHeader& header = *reader.Read<LibraryFileHeader>(1);
+  if (!std::equal(LIBRARY_FILE_MAGIC, LIBRARY_FILE_MAGIC + 8, header.magic) ||
+      header.byteOrder != LIBRARY_FILE_BYTE_ORDER) {
+    throw std::runtime_error("The manuever library file has an unknown "
+                             "format.");
+  }
+  if (header.version != LIBRARY_FILE_VERSION) {
+    throw std::runtime_error("The manuever library file was saved by another "
+                             "version.");
+  }
+  if (header.width != carDescription_.GetWidth() ||
+      header.length != carDescription_.GetLength() ||
+      header.maxSteeringAngle != carDescription_.GetMaxSteeringAngle() ||
+      header.latticeStep != latticeStep_ ||
+      header.numberOfHeadings != numberOfHeadings_ ||
+      header.maxOffset != maxOffset_) {
+    throw std::runtime_error("The manuever library file is for another car.");
+  }
+
+  int number_of_manuevers = header.numberOfManuevers;
+  std::vector<int> manuever_indices;
+  reader.ReadArray(GetNumberOfEntries(), &manuever_indices);
+  for (unsigned index = 0; index < manuever_indices.size(); ++index) {
+    if (manuever_indices[index] < -1 ||
+        manuever_indices[index] >= number_of_manuevers) {
+      throw std::runtime_error("The manuever library file is corrupted.");
+    }
+  }
+  reader.ReadArray(number_of_manuevers, &initialStraightSectionDistances_);
+  reader.ReadArray(number_of_manuevers, &finalStraightSectionDistances_);
+  reader.ReadArray(number_of_manuevers, &turnAngles_);
+  reader.ReadArray(number_of_manuevers, &rotationCenterX_);
+  reader.ReadArray(number_of_manuevers, &rotationCenterY_);
+  if (!reader.AtEnd()) {
+    throw std::runtime_error("The manuever library file is corrupted.");
+  }
+  manueverIndices_.swap(manuever_indices);
+}
+
+ManueverLibrary::LookupResult ManueverLibrary::Lookup(
+    const CarPosition& from, const CarPosition& to,
+    const geometry::Vector& lattice_axis, CarManuever* manuever) const {
+  geometry::Vector across = lattice_axis.GetOrthogonal();
+  geometry::Vector offset(from.GetCenter(), to.GetCenter());
+  double heading_step = 2.0 * geometry::GeometryUtils::PI / numberOfHeadings_;
+  const geometry::Vector& from_direction = from.GetDirection();
+  const geometry::Vector& to_direction = to.GetDirection();
+
+  bool on_lattice = true;
+  int offset_x = GetLatticeIndex(offset.DotProduct(lattice_axis),
+                                 latticeStep_, &on_lattice);
+  int offset_y = GetLatticeIndex(offset.DotProduct(across),
+                                 latticeStep_, &on_lattice);
+  int from_heading = GetLatticeIndex(
+      atan2(lattice_axis.CrossProduct(from_direction),
+            lattice_axis.DotProduct(from_direction)),
+      heading_step, &on_lattice);
+  int to_heading = GetLatticeIndex(
+      atan2(lattice_axis.CrossProduct(to_direction),
+            lattice_axis.DotProduct(to_direction)),
+      heading_step, &on_lattice);
+  if (!on_lattice || abs(offset_x) > maxOffset_ ||
+      abs(offset_y) > maxOffset_) {
+    return NOT_ON_LATTICE;
+  }
+  from_heading = (from_heading + numberOfHeadings_) % numberOfHeadings_;
+  to_heading = (to_heading + numberOfHeadings_) % numberOfHeadings_;
+
+  int index = manueverIndices_[GetEntryIndex(from_heading, to_heading,
+                                             offset_x, offset_y)];
+  if (index == -1) {
+    return NO_MANUEVER;
+  }
+  *manuever = CarManuever(from);
+  manuever->SetInitialStraightSectionDistance(
+      initialStraightSectionDistances_[index]);
+  manuever->SetTurnAngle(turnAngles_[index]);
+  if (!DoubleIsZero(turnAngles_[index])) {
+    manuever->SetRotationCenter(from.GetCenter() +
+                                lattice_axis * rotationCenterX_[index] +
+                                across * rotationCenterY_[index]);
+  }
+  manuever->SetFinalStraightSectionDistance(
+      finalStraightSectionDistances_[index]);
+  return MANUEVER_FOUND;
+}
+
+int ManueverLibrary::GetNumberOfManuevers() const {
+  return turnAngles_.size();
+}
+
+}  // namespace simulation
@@ -0,0 +1,93 @@
+#ifndef SIMULATION_MANUEVER_LIBRARY_H_
+#define SIMULATION_MANUEVER_LIBRARY_H_
+
+#include "geometry/vector.h"
+#include "simulation/car_description.h"
+
+#include <string>
+#include <vector>
+
+namespace simulation {
+
+class CarManuever;
+class CarPosition;
+
+// The single manuevers of a car between the positions of a lattice, solved
+// once for all the layouts. The positions of an object are sampled on a
+// lattice along its axis: their centers are apart by multiples of the lattice
+// step along the axis and across it and their headings are multiples of a
+// full turn divided by the number of headings, measured from the axis. The
+// manuever between two such positions depends only on their relative heading
+// and offset, so the library keeps the manuever found by
+// CarMovementHandler::SingleManueverBetweenStates in an empty world for
+// every pair of a start heading and an end heading and offset within
+// the default reach of the graph. Only the collision checks are left for the
+// layout, and the pairs further apart are solved.
+//
+// A library depends only on the car description and the lattice, so it can
+// be saved and shared by all the cars of the same model.
+class ManueverLibrary {
+ public:
+  enum LookupResult {
+    // The positions are not on a common lattice or too far from each other,
+    // so the manuever should be solved for them.
+    NOT_ON_LATTICE,
+    NO_MANUEVER,
+    MANUEVER_FOUND
+  };
+
+ public:
+  ManueverLibrary(const CarDescription& car_description, double lattice_step,
+                  int number_of_headings);
+
+  // Solves the manuevers of all the lattice offsets within reach.
+  void Build();
+
+  // The name of the file the library is saved to, made of a hash of the
+  // car description and the lattice, so that libraries of different cars
+  // may be kept in the same directory.
+  std::string GetFileName() const;
+
+  void Save(const std::string& file) const;
+
+  // Loads a library saved by Save. Throws std::runtime_error if the file is
+  // missing, was saved by another version or for another car or lattice.
+  void Load(const std::string& file);
+
+  // Looks up the manuever from "from" to "to", whose lattice runs along
+  // the unit vector "lattice_axis". If one is found it is stored in
+  // "manuever", starting from "from", and should still be checked with
+  // CarMovementHandler::ManueverPossible.
+  LookupResult Lookup(const CarPosition& from, const CarPosition& to,
+                      const geometry::Vector& lattice_axis,
+                      CarManuever* manuever) const;
+
+  int GetNumberOfManuevers() const;
+
+ private:
+  // Returns the index of the entry for the given headings and offset.
+  int GetEntryIndex(int from_heading, int to_heading,
+                    int offset_x, int offset_y) const;
+  int GetNumberOfEntries() const;
+
+ private:
+  CarDescription carDescription_;
+  double latticeStep_;
+  int numberOfHeadings_;
+  // The offsets are within [-maxOffset_, maxOffset_] lattice steps.
+  int maxOffset_;
+
+  // The index of the manuever of every entry or -1 if there is none.
+  std::vector<int> manueverIndices_;
+  // The manuevers are kept in the frame of the lattice, starting from its
+  // origin.
+  std::vector<double> initialStraightSectionDistances_;
+  std::vector<double> finalStraightSectionDistances_;
+  std::vector<double> turnAngles_;
+  std::vector<double> rotationCenterX_;
+  std::vector<double> rotationCenterY_;
+};
+
+}  // namespace simulation
+
+#endif  // SIMULATION_MANUEVER_LIBRARY_H_
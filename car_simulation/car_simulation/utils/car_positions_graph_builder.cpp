@@ -1,139 +1,298 @@
-#include "utils/car_positions_graph_builder.h"
-
-#include "geometry/bounding_box.h"
-#include "geometry/boundary_line.h"
-#include "geometry/geometry_utils.h"
-#include "geometry/point.h"
-#include "geometry/polygon.h"
-#include "geometry/rectangle_object.h"
-#include "geometry/straight_boundary_line.h"
-#include "geometry/vector.h"
-#include "simulation/car_description.h"
-#include "simulation/car_positions_graph.h"
-#include "utils/double_utils.h"
-#include "utils/intersection_handler.h"
-#include "utils/object_holder.h"
-
-#include "visualize/scene.h"
-
-const bool ADD_POSITIONS_TO_SCENE = false;
-
-namespace utils {
-
-// Static declaration
-const double CarPositionsGraphBuilder::SAMPLING_STEP = 1.0;
-
-CarPositionsGraphBuilder::CarPositionsGraphBuilder(
-    const ObjectHolder &object_holder,
-    const IntersectionHandler &intersection_handler)
-  : intersectionHandler_(intersection_handler),
-    objectHolder_(object_holder) {}
-
-void CarPositionsGraphBuilder::CreateCarPositionsGraph(
-    simulation::CarPositionsGraph *graph) const {
-  const RectangleObjectContainer& roads = objectHolder_.GetRoadSegments();
-  for (unsigned i = 0; i < roads.size(); ++i) {
-    AddPositionsForObject(roads[i], false, graph);
-  }
-
-  const RectangleObjectContainer& parking_lots = objectHolder_.GetParkingLots();
-  for (unsigned i = 0; i < parking_lots.size(); ++i) {
-    AddPositionsForObject(parking_lots[i], true, graph);
-  }
-
-  graph->FinalizeGraph();
-}
-
-double CarPositionsGraphBuilder::GetSamplingStep() {
-  return SAMPLING_STEP;
-}
-
-void CarPositionsGraphBuilder::AddPositionsForObject(
-    const geometry::RectangleObject* object, bool final,
-    simulation::CarPositionsGraph* graph) const {
-  const geometry::Point& from = object->GetFrom();
-  const geometry::Point& to = object->GetTo();
-  double length = from.GetDistance(to);
-  double width = object->GetWidth();
-  geometry::Vector ox = geometry::Vector(from, to).Unit();
-  geometry::Vector oy = ox.GetOrthogonal().Unit();
-
-  geometry::Point origin = from - oy * width * 0.5;
-  std::vector<double> y_fractions;
-  for (double u = 0; u < width; u += SAMPLING_STEP) {
-    y_fractions.push_back(u);
-  }
-  if (DoubleIsGreater(width, y_fractions.back() + SAMPLING_STEP * 0.5)) {
-    y_fractions.push_back(width);
-  }
-  std::vector<double> x_fractions;
-  for (double u = 0; u < length; u += SAMPLING_STEP) {
-    x_fractions.push_back(u);
-  }
-  if (DoubleIsGreater(length, x_fractions.back() + SAMPLING_STEP * 0.5)) {
-    x_fractions.push_back(length);
-  }
-  const simulation::CarDescription& description = graph->GetCarDescription();
-  const double pi = geometry::GeometryUtils::PI;
-  const double angle_step = pi / 10;
-  for (unsigned i = 0; i < y_fractions.size();++i) {
-    for (unsigned j = 0; j < x_fractions.size();++j) {
-      geometry::Point center = origin + ox * x_fractions[j] +
-           oy * y_fractions[i];
-      for (double angle = 0; angle < 1.999 * pi; angle += angle_step) {
-        // Do not allow going back on one way segments.
-        if (object->IsDirected() && 
-            DoubleIsStrictlyBetween(angle, pi * 0.5, pi * 1.5)) {
-          continue;
-        }
-        simulation::CarPosition car_position;
-        car_position.SetCenter(center);
-        car_position.SetDirection(ox.Rotate(angle));
-        car_position.SetIsFinal(final);
-                
-        if (final) {
-          geometry::Polygon bounds;
-          description.GetBounds(car_position, bounds);
-          for (unsigned vert = 0; vert < bounds.NumberOfVertices(); ++vert) {
-            if (!object->ContainsPoint(bounds.GetPoint(vert))) {
-              car_position.SetIsFinal(false);
-              break;
-            }
-          }
-        }
-
-        if (CarPositionIsPossible(description, car_position)) {
-          if (DoubleIsZero(angle) || DoubleEquals(angle, pi)) {
-            car_position.SetIsAlongBaseLine(true);
-          }
-          if (ADD_POSITIONS_TO_SCENE) {
-            visualize::Scene::AddPosition(car_position.GetCenter(),
-                                          car_position.GetDirection().Unit());
-          }
-          graph->AddPosition(car_position, object);
-        }
-      }
-    }
-  }
-}
-
-bool CarPositionsGraphBuilder::CarPositionIsPossible(
-    const simulation::CarDescription& car_description,
-    const simulation::CarPosition& car_position) const {
-  geometry::Polygon bounds;
-  car_description.GetBounds(car_position, bounds);
-  std::vector<const geometry::BoundaryLine*> lines;
-  intersectionHandler_.GetBoundaryLines(bounds.GetBoundingBox(), &lines);
-
-  for (unsigned i = 0; i < lines.size(); ++i) {
-    const geometry::StraightBoundaryLine* straight_line =
-        dynamic_cast<const geometry::StraightBoundaryLine*>(lines[i]);
-    if (geometry::Intersect(bounds, straight_line->GetSegment(), NULL)) {
-      return false;
-    }
-  }
-
-  return true;
-}
-
-}  // namespace utils
+#include "utils/car_positions_graph_builder.h"
+
+#include "geometry/boundary_line.h"
+#include "geometry/bounding_box.h"
+#include "geometry/geometry_utils.h"
+#include "geometry/point.h"
+#include "geometry/polygon.h"
+#include "geometry/rectangle_object.h"
+#include "geometry/segment.h"
+#include "geometry/straight_boundary_line.h"
+#include "geometry/vector.h"
+#include "simulation/car_description.h"
+#include "simulation/car_position.h"
+#include "simulation/car_positions_graph.h"
+#include "utils/binary_file.h"
+#include "utils/double_utils.h"
+#include "utils/intersection_handler.h"
+#include "utils/mapped_file.h"
+#include "utils/object_holder.h"
+#include "utils/thread_pool.h"
+
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace utils {
+
+// Static declaration
+const double CarPositionsGraphBuilder::SAMPLING_STEP = 1.0;
+const int CarPositionsGraphBuilder::NUMBER_OF_HEADINGS = 20;
+
+// Samples the positions of a single object. Every object is a separate task
+// and its positions are kept aside until all objects are processed so that
+// they can be added to the graph in the same order as in a serial build.
+class PositionsSamplingTask : public ParallelTask {
+ public:
+  PositionsSamplingTask(
+      const CarPositionsGraphBuilder* builder,
+      const std::vector<std::pair<const geometry::RectangleObject*, bool> >&
+          objects,
+      const simulation::CarDescription& description)
+    : builder_(builder), objects_(objects), description_(description),
+      positions_(objects.size()) {}
+
+  virtual void Run(int task_index, int /*thread_index*/) {
+    builder_->SamplePositionsForObject(objects_[task_index].first,
+        objects_[task_index].second, description_, &positions_[task_index]);
+  }
+
+  const std::vector<simulation::CarPosition>& GetPositions(
+      int task_index) const {
+    return positions_[task_index];
+  }
+
+ private:
+  const CarPositionsGraphBuilder* builder_;
+  const std::vector<std::pair<const geometry::RectangleObject*, bool> >&
+      objects_;
+  const simulation::CarDescription& description_;
+  std::vector<std::vector<simulation::CarPosition> > positions_;
+};
+
+CarPositionsGraphBuilder::CarPositionsGraphBuilder(
+    const ObjectHolder &object_holder,
+    const IntersectionHandler &intersection_handler)
+  : intersectionHandler_(intersection_handler),
+    objectHolder_(object_holder),
+    threadPool_(NULL),
+    computeEdgesEagerly_(false),
+    layoutHash_(HASH_OFFSET_BASIS) {}
+
+void CarPositionsGraphBuilder::SetThreadPool(ThreadPool* thread_pool) {
+  threadPool_ = thread_pool;
+}
+
+void CarPositionsGraphBuilder::SetComputeEdgesEagerly(bool eager) {
+  computeEdgesEagerly_ = eager;
+}
+
+void CarPositionsGraphBuilder::SetLayoutFile(const std::string& layout_file) {
+  MappedFile layout(layout_file);
+  layoutHash_ = HashBytes(layout.GetData(), layout.GetSize(),
+                          HASH_OFFSET_BASIS);
+}
+
+void CarPositionsGraphBuilder::SetGraphCacheFile(
+    const std::string& cache_file, const std::string& layout_file) {
+  SetLayoutFile(layout_file);
+  graphCacheFile_ = cache_file;
+}
+
+void CarPositionsGraphBuilder::CreateCarPositionsGraph(
+    simulation::CarPositionsGraph *graph) const {
+  std::vector<std::pair<const geometry::RectangleObject*, bool> > objects;
+  const RectangleObjectContainer& roads = objectHolder_.GetRoadSegments();
+  for (unsigned i = 0; i < roads.size(); ++i) {
+    objects.push_back(std::make_pair(roads[i], false));
+  }
+
+  const RectangleObjectContainer& parking_lots = objectHolder_.GetParkingLots();
+  for (unsigned i = 0; i < parking_lots.size(); ++i) {
+    objects.push_back(std::make_pair(parking_lots[i], true));
+  }
+
+  // The cached graphs refer to the objects by their index in this list.
+  std::vector<const geometry::RectangleObject*> layout_objects;
+  for (unsigned i = 0; i < objects.size(); ++i) {
+    layout_objects.push_back(objects[i].first);
+  }
+  unsigned long long key = 0;
+  if (!graphCacheFile_.empty()) {
+    key = GetGraphKey(*graph);
+    try {
+      graph->LoadFrozenGraph(graphCacheFile_, key, layout_objects);
+      return;
+    } catch (const std::runtime_error& e) {
+      std::cerr << "Rebuilding " << graphCacheFile_ << ": " << e.what()
+                << std::endl;
+    }
+  }
+
+  // The positions added by the caller keep their indices.
+  graph->SetNumberOfFixedPositions(graph->GetNumberOfPositions());
+  const simulation::CarDescription& description = graph->GetCarDescription();
+  if (threadPool_ == NULL) {
+    std::vector<simulation::CarPosition> positions;
+    for (unsigned i = 0; i < objects.size(); ++i) {
+      positions.clear();
+      SamplePositionsForObject(objects[i].first, objects[i].second,
+                               description, &positions);
+      for (unsigned j = 0; j < positions.size(); ++j) {
+        graph->AddPosition(positions[j], objects[i].first);
+      }
+    }
+  } else {
+    PositionsSamplingTask task(this, objects, description);
+    threadPool_->ParallelFor(static_cast<int>(objects.size()), &task);
+    for (unsigned i = 0; i < objects.size(); ++i) {
+      const std::vector<simulation::CarPosition>& positions =
+          task.GetPositions(i);
+      for (unsigned j = 0; j < positions.size(); ++j) {
+        graph->AddPosition(positions[j], objects[i].first);
+      }
+    }
+  }
+
+  if (computeEdgesEagerly_ || !graphCacheFile_.empty()) {
+    graph->FinalizeGraphEagerly(threadPool_);
+  } else {
+    graph->FinalizeGraph();
+  }
+
+  if (!graphCacheFile_.empty()) {
+    try {
+      graph->SaveFrozenGraph(graphCacheFile_, key, layout_objects);
+    } catch (const std::runtime_error& e) {
+      std::cerr << "The graph is not cached: " << e.what() << std::endl;
+    }
+  }
+}
+
+unsigned long long CarPositionsGraphBuilder::GetGraphKey(
+    const simulation::CarPositionsGraph& graph) const {
+  const simulation::CarDescription& description = graph.GetCarDescription();
+  unsigned long long key = layoutHash_;
+  key = HashDouble(description.GetWidth(), key);
+  key = HashDouble(description.GetLength(), key);
+  key = HashDouble(description.GetMaxSteeringAngle(), key);
+  key = HashDouble(SAMPLING_STEP, key);
+  key = HashDouble(graph.GetManueverReach(), key);
+
+  // The positions and the manuevers are validated against the boundary
+  // lines, which depend on the grid mode and the tolerances of the
+  // intersection handler. The manuevers of a library may differ from the
+  // solved ones in the last bits.
+  bool adaptive_grid = intersectionHandler_.IsAdaptiveGrid();
+  key = HashBytes(&adaptive_grid, sizeof(adaptive_grid), key);
+  std::vector<const geometry::BoundaryLine*> boundary_lines;
+  intersectionHandler_.GetBoundaryLines(&boundary_lines);
+  int number_of_lines = boundary_lines.size();
+  key = HashBytes(&number_of_lines, sizeof(number_of_lines), key);
+  for (int index = 0; index < number_of_lines; ++index) {
+    const geometry::Segment& segment =
+        static_cast<const geometry::StraightBoundaryLine*>(
+            boundary_lines[index])->GetSegment();
+    key = HashDouble(segment.A().x, key);
+    key = HashDouble(segment.A().y, key);
+    key = HashDouble(segment.B().x, key);
+    key = HashDouble(segment.B().y, key);
+  }
+  bool uses_library = graph.GetManueverLibrary() != NULL;
+  key = HashBytes(&uses_library, sizeof(uses_library), key);
+  return key;
+}
+
+unsigned long long CarPositionsGraphBuilder::GetGraphKeyWithFixedPositions(
+    const simulation::CarPositionsGraph& graph) const {
+  unsigned long long key = GetGraphKey(graph);
+  int number_of_positions = graph.GetNumberOfFixedPositions();
+  key = HashBytes(&number_of_positions, sizeof(number_of_positions), key);
+  for (int index = 0; index < number_of_positions; ++index) {
+    simulation::CarPosition position = graph.GetPosition(index);
+    key = HashDouble(position.GetCenter().x, key);
+    key = HashDouble(position.GetCenter().y, key);
+    key = HashDouble(position.GetDirection().x, key);
+    key = HashDouble(position.GetDirection().y, key);
+  }
+  return key;
+}
+
+double CarPositionsGraphBuilder::GetSamplingStep() {
+  return SAMPLING_STEP;
+}
+
+int CarPositionsGraphBuilder::GetNumberOfHeadings() {
+  return NUMBER_OF_HEADINGS;
+}
+
+void CarPositionsGraphBuilder::SamplePositionsForObject(
+    const geometry::RectangleObject* object, bool final,
+    const simulation::CarDescription& description,
+    std::vector<simulation::CarPosition>* positions) const {
+  const geometry::Point& from = object->GetFrom();
+  const geometry::Point& to = object->GetTo();
+  double length = from.GetDistance(to);
+  double width = object->GetWidth();
+  geometry::Vector ox = geometry::Vector(from, to).Unit();
+  geometry::Vector oy = ox.GetOrthogonal().Unit();
+
+  geometry::Point origin = from - oy * width * 0.5;
+  std::vector<double> y_fractions;
+  for (double u = 0; u < width; u += SAMPLING_STEP) {
+    y_fractions.push_back(u);
+  }
+  if (DoubleIsGreater(width, y_fractions.back() + SAMPLING_STEP * 0.5)) {
+    y_fractions.push_back(width);
+  }
+  std::vector<double> x_fractions;
+  for (double u = 0; u < length; u += SAMPLING_STEP) {
+    x_fractions.push_back(u);
+  }
+  if (DoubleIsGreater(length, x_fractions.back() + SAMPLING_STEP * 0.5)) {
+    x_fractions.push_back(length);
+  }
+  const double pi = geometry::GeometryUtils::PI;
+  const double angle_step = 2.0 * pi / NUMBER_OF_HEADINGS;
+  geometry::Polygon bounds;
+  std::vector<geometry::SegmentSpan> spans;
+  for (unsigned i = 0; i < y_fractions.size();++i) {
+    for (unsigned j = 0; j < x_fractions.size();++j) {
+      geometry::Point center = origin + ox * x_fractions[j] +
+           oy * y_fractions[i];
+      for (double angle = 0; angle < 1.999 * pi; angle += angle_step) {
+        // Do not allow going back on one way segments.
+        if (object->IsDirected() && 
+            DoubleIsStrictlyBetween(angle, pi * 0.5, pi * 1.5)) {
+          continue;
+        }
+        simulation::CarPosition car_position;
+        car_position.SetCenter(center);
+        car_position.SetDirection(ox.Rotate(angle));
+        car_position.SetIsFinal(final);
+                
+        if (final) {
+          description.GetBounds(car_position, bounds);
+          for (unsigned vert = 0; vert < bounds.NumberOfVertices(); ++vert) {
+            if (!object->ContainsPoint(bounds.GetPoint(vert))) {
+              car_position.SetIsFinal(false);
+              break;
+            }
+          }
+        }
+
+        if (CarPositionIsPossible(description, car_position, &bounds,
+                                  &spans)) {
+          if (DoubleIsZero(angle) || DoubleEquals(angle, pi)) {
+            car_position.SetIsAlongBaseLine(true);
+          }
+          positions->push_back(car_position);
+        }
+      }
+    }
+  }
+}
+
+bool CarPositionsGraphBuilder::CarPositionIsPossible(
+    const simulation::CarDescription& car_description,
+    const simulation::CarPosition& car_position,
+    geometry::Polygon* bounds,
+    std::vector<geometry::SegmentSpan>* spans) const {
+  car_description.GetBounds(car_position, *bounds);
+  return intersectionHandler_.GetIntersectedBoundarySegment(
+      *bounds, spans) == NULL;
+}
+
+}  // namespace utils
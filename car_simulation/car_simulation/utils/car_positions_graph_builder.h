@@ -1,41 +1,101 @@
-#ifndef UTILS_CAR_POSITIONS_GRAPH_BUILDER_H
-#define UTILS_CAR_POSITIONS_GRAPH_BUILDER_H
-
-#include "utils/intersection_handler.h"
-#include "utils/object_holder.h"
-
-namespace geometry {
-class RectangleObject;
-}  // namespace geometry
-
-namespace simulation {
-class CarDescription;
-class CarPosition;
-class CarPositionsGraph;
-}  // namespace simulation
-
-namespace utils {
-class CarPositionsGraphBuilder {
- public:
-  CarPositionsGraphBuilder(const ObjectHolder& object_holder,
-                           const IntersectionHandler& intersection_handler);
-
-  void CreateCarPositionsGraph(simulation::CarPositionsGraph* graph) const;
-
-  static double GetSamplingStep();
-
- private:
-  void AddPositionsForObject(
-      const geometry::RectangleObject* object, bool final,
-      simulation::CarPositionsGraph* graph) const;
-  bool CarPositionIsPossible(const simulation::CarDescription& car_description,
-                             const simulation::CarPosition& car_position) const;
-
- private:
-  static const double SAMPLING_STEP;
-  const ObjectHolder& objectHolder_;
-  const IntersectionHandler& intersectionHandler_;
-};
-
-}  // namespace utils
-#endif // UTILS_CAR_POSITIONS_GRAPH_BUILDER_H
+#ifndef UTILS_CAR_POSITIONS_GRAPH_BUILDER_H
+#define UTILS_CAR_POSITIONS_GRAPH_BUILDER_H
+
+#include "utils/intersection_handler.h"
+#include "utils/object_holder.h"
+
+#include <string>
+#include <vector>
+
+namespace geometry {
+class Polygon;
+class RectangleObject;
+}  // namespace geometry
+
+namespace simulation {
+class CarDescription;
+class CarPosition;
+class CarPositionsGraph;
+}  // namespace simulation
+
+namespace utils {
+
+class ThreadPool;
+
+class CarPositionsGraphBuilder {
+ public:
+  CarPositionsGraphBuilder(const ObjectHolder& object_holder,
+                           const IntersectionHandler& intersection_handler);
+
+  // When a thread pool is set the positions of the different objects are
+  // sampled and validated in parallel. They are still added to the graph in
+  // the order of a serial build, so position indices do not depend on the
+  // number of threads. Pass NULL to build serially (the default).
+  void SetThreadPool(ThreadPool* thread_pool);
+
+  // If set, all the edges of the graph are computed while building it (using
+  // the thread pool if there is one) instead of lazily during routing.
+  void SetComputeEdgesEagerly(bool eager);
+
+  // "layout_file" is the file the object holder was parsed from. Its
+  // contents become part of the keys returned by GetGraphKey.
+  void SetLayoutFile(const std::string& layout_file);
+
+  // If set, the graph is loaded from "cache_file" if it was saved there with
+  // the same key (see GetGraphKey), and is built and saved there otherwise.
+  // Only the positions sampled on the layout are saved, so the cache is
+  // shared by all the start positions: the positions added by the caller are
+  // connected to the loaded graph. Calls SetLayoutFile with "layout_file".
+  // Cached graphs are always frozen, as if SetComputeEdgesEagerly(true) was
+  // called.
+  void SetGraphCacheFile(const std::string& cache_file,
+                         const std::string& layout_file);
+
+  void CreateCarPositionsGraph(simulation::CarPositionsGraph* graph) const;
+
+  // Returns the key of the positions the builder samples for "graph" and of
+  // the edges between them: a hash of the layout file set by SetLayoutFile,
+  // the car, the sampling step, the manuever reach of the graph, the grid mode
+  // and the boundary lines of the intersection handler and whether the
+  // manuevers come from a library. It does not depend on the positions added
+  // by the caller. The cached graphs are tagged with it.
+  unsigned long long GetGraphKey(
+      const simulation::CarPositionsGraph& graph) const;
+
+  // Same as GetGraphKey but also depends on the fixed positions of "graph",
+  // such as the start positions of the routes. Files derived from the whole
+  // graph, such as a saved tree of routes, are tagged with it.
+  unsigned long long GetGraphKeyWithFixedPositions(
+      const simulation::CarPositionsGraph& graph) const;
+
+  static double GetSamplingStep();
+  // The headings of the positions are sampled at multiples of a full turn
+  // divided by this number, measured from the axis of their object.
+  static int GetNumberOfHeadings();
+
+ private:
+  friend class PositionsSamplingTask;
+
+  void SamplePositionsForObject(
+      const geometry::RectangleObject* object, bool final,
+      const simulation::CarDescription& description,
+      std::vector<simulation::CarPosition>* positions) const;
+  // "bounds" and "spans" are scratch buffers reused between the calls.
+  bool CarPositionIsPossible(const simulation::CarDescription& car_description,
+                             const simulation::CarPosition& car_position,
+                             geometry::Polygon* bounds,
+                             std::vector<geometry::SegmentSpan>* spans) const;
+
+ private:
+  static const double SAMPLING_STEP;
+  static const int NUMBER_OF_HEADINGS;
+  const ObjectHolder& objectHolder_;
+  const IntersectionHandler& intersectionHandler_;
+  ThreadPool* threadPool_;
+  bool computeEdgesEagerly_;
+  std::string graphCacheFile_;
+  unsigned long long layoutHash_;
+};
+
+}  // namespace utils
+#endif // UTILS_CAR_POSITIONS_GRAPH_BUILDER_H
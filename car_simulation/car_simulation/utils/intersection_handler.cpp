@@ -1,161 +1,241 @@
-#include "utils/intersection_handler.h"
-
-#include "geometry/boundary_line.h"
-#include "geometry/bounding_box.h"
-#include "geometry/polygon.h"
-#include "geometry/rectangle_object.h"
-#include "geometry/segment.h"
-#include "geometry/straight_boundary_line.h"
-#include "geometry/vector.h"
-#include "utils/boundary_line_holder.h"
-#include "utils/double_utils.h"
-#include "utils/object_holder.h"
-
-#include <algorithm>
-#include <vector>
-
-namespace utils {
-
-static const double GAP_TOLERANCE = 0.6;
-
-IntersectionHandler::IntersectionHandler(double minx, double maxx,
-    double miny, double maxy, BoundaryLinesHolder* boundary_lines_holder)
-        : grid_(minx, maxx, miny, maxy), 
-          boundaryLinesHolder_(boundary_lines_holder) {}
-
-
-void IntersectionHandler::Init(const ObjectHolder& object_holder) {
-  const std::vector<geometry::RectangleObject*>& road_segments =
-      object_holder.GetRoadSegments();
-
-  for (unsigned index = 0; index < road_segments.size(); ++index) {
-    grid_.AddRectangleObject(road_segments[index]);
-  }
-
-  const std::vector<geometry::RectangleObject*>& parking_lots =
-      object_holder.GetParkingLots();
-  
-  for (unsigned index = 0; index < parking_lots.size(); ++index) {
-    grid_.AddRectangleObject(parking_lots[index]);
-  }
-
-  const std::vector<geometry::RectangleObject*>& obstacles =
-      object_holder.GetObstacles();
-  
-  for (unsigned index = 0; index < obstacles.size(); ++index) {
-    grid_.AddRectangleObject(obstacles[index]);
-  }
-
-  for (unsigned index = 0; index < obstacles.size(); ++index) {
-    geometry::Polygon bounds = obstacles[index]->GetBounds();
-    for (unsigned side_index = 0; side_index < bounds.NumberOfSides();
-        ++side_index) {
-      grid_.AddBoundaryLine(boundaryLinesHolder_->
-          AddStraightBoundaryLine(bounds.GetSide(side_index), false));
-    }
-  }
-
-  for (unsigned index = 0; index < road_segments.size(); ++index) {
-    AddBoundaryLinesForObject(road_segments[index]);
-  }
-  for (unsigned index = 0; index < parking_lots.size(); ++index) {
-    AddBoundaryLinesForObject(parking_lots[index]);
-  }
-
-  RemoveSmallBoundaryLines();
-}
-
-void IntersectionHandler::GetBoundaryLines(
-    const geometry::BoundingBox& bounding_box,
-    std::vector<const geometry::BoundaryLine*>* result) const {
-  grid_.GetBoundaryLines(bounding_box, result);
-}
-
-void IntersectionHandler::GetBoundaryLines(
-    std::vector<const geometry::BoundaryLine*>* result) const {
-  grid_.GetBoundaryLines(result);
-}
-
-void IntersectionHandler::AddBoundaryLinesForObject(
-    const geometry::RectangleObject* object){
-  const geometry::Polygon bounds = object->GetBounds();
-
-  for (unsigned side_index = 0; side_index < bounds.NumberOfSides();
-      ++side_index) {
-    geometry::Segment segment = bounds.GetSide(side_index);
-
-    std::vector<const geometry::RectangleObject*> objects =
-      grid_.GetRectangleObjects(segment.GetBoundingBox());
-    
-    std::vector<std::pair<double, double> > overlapped_intervals;
-    for (unsigned index = 0; index < objects.size(); ++index) {
-      if (objects[index] == object) {
-        continue;
-      }
-      std::pair<double, double> interval;
-      geometry::Polygon obj_bounds = objects[index]->GetBounds();
-      if (Intersect(obj_bounds, segment, &interval)) {
-        overlapped_intervals.push_back(interval);
-      }
-      
-      obj_bounds.Translate(bounds.GetSideNormal(side_index).Unit() * GAP_TOLERANCE);
-      if (Intersect(obj_bounds, segment, &interval)) {
-        overlapped_intervals.push_back(interval);
-      }
-    }
-    sort(overlapped_intervals.begin(), overlapped_intervals.end());
-    double current_fraction = 0.0;
-    for (unsigned index = 0; index < overlapped_intervals.size(); ++index) {
-      if (DoubleIsGreater(overlapped_intervals[index].first,
-          current_fraction)) {
-        geometry::Segment sub_segment(segment.SubSegment(current_fraction,
-            overlapped_intervals[index].first));
-
-        grid_.AddBoundaryLine(boundaryLinesHolder_->
-            AddStraightBoundaryLine(sub_segment, false));
-      }
-
-      current_fraction = std::max(current_fraction,
-          overlapped_intervals[index].second);
-    }
-
-    if (DoubleIsGreater(1.0, current_fraction)) {
-        geometry::Segment sub_segment(segment.SubSegment(current_fraction, 1.0));
-        grid_.AddBoundaryLine(boundaryLinesHolder_->
-            AddStraightBoundaryLine(sub_segment, false));
-    }
-  } 
-}
-
-void IntersectionHandler::RemoveSmallBoundaryLines() {
-  std::vector<const geometry::BoundaryLine*> boundary_lines;
-  grid_.GetBoundaryLines(&boundary_lines);
-  for (unsigned index = 0; index < boundary_lines.size(); ++index) {
-    if (DoubleIsGreater(boundary_lines[index]->GetLength(), GAP_TOLERANCE)) {
-      continue;
-    }
-    geometry::BoundingBox bounding_box = 
-        boundary_lines[index]->GetBoundingBox();
-    std::vector<const geometry::BoundaryLine*> neighbouring_lines;
-    grid_.GetBoundaryLines(bounding_box.GetExpanded(GAP_TOLERANCE), 
-        &neighbouring_lines);
-
-    bool has_long_neighbour = false;
-    for (unsigned neighbour_index = 0; neighbour_index <
-        neighbouring_lines.size(); ++neighbour_index) {
-      const geometry::BoundaryLine* neighbour =
-          neighbouring_lines[neighbour_index];
-      if (DoubleIsGreater(neighbour->GetLength(),GAP_TOLERANCE) && 
-          neighbour->GetBoundingBox().Intersect(bounding_box)) {
-        has_long_neighbour = true;
-        break;    
-      }   
-    }
-
-    if (!has_long_neighbour) {
-      grid_.RemoveBoundaryLine(boundary_lines[index]);
-    }
-  }
-}
-
+#include "utils/intersection_handler.h"
+
+#include "geometry/boundary_line.h"
+#include "geometry/bounding_box.h"
+#include "geometry/polygon.h"
+#include "geometry/rectangle_object.h"
+#include "geometry/segment.h"
+#include "geometry/straight_boundary_line.h"
+#include "geometry/vector.h"
+#include "utils/boundary_line_holder.h"
+#include "utils/double_utils.h"
+#include "utils/object_holder.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace utils {
+
+static const double GAP_TOLERANCE = 0.6;
+
+// An adaptive grid aims at this many object sides crossing a cell on average
+// but never has cells smaller than MIN_CELL_SIZE or more than MAX_CELLS cells
+// along an axis.
+static const double SIDES_PER_CELL = 1.0;
+static const double MIN_CELL_SIZE = 1.0;
+static const int MAX_CELLS = 1000;
+
+IntersectionHandler::IntersectionHandler(double minx, double maxx,
+    double miny, double maxy, BoundaryLinesHolder* boundary_lines_holder)
+        : grid_(minx, maxx, miny, maxy), 
+          boundaryLinesHolder_(boundary_lines_holder),
+          adaptiveGrid_(true) {}
+
+void IntersectionHandler::SetAdaptiveGrid(bool adaptive) {
+  adaptiveGrid_ = adaptive;
+}
+
+bool IntersectionHandler::IsAdaptiveGrid() const {
+  return adaptiveGrid_;
+}
+
+void IntersectionHandler::Init(const ObjectHolder& object_holder) {
+  if (adaptiveGrid_) {
+    FitGridToLayout(object_holder);
+  }
+
+  const std::vector<geometry::RectangleObject*>& road_segments =
+      object_holder.GetRoadSegments();
+
+  for (unsigned index = 0; index < road_segments.size(); ++index) {
+    grid_.AddRectangleObject(road_segments[index]);
+  }
+
+  const std::vector<geometry::RectangleObject*>& parking_lots =
+      object_holder.GetParkingLots();
+  
+  for (unsigned index = 0; index < parking_lots.size(); ++index) {
+    grid_.AddRectangleObject(parking_lots[index]);
+  }
+
+  const std::vector<geometry::RectangleObject*>& obstacles =
+      object_holder.GetObstacles();
+  
+  for (unsigned index = 0; index < obstacles.size(); ++index) {
+    grid_.AddRectangleObject(obstacles[index]);
+  }
+
+  for (unsigned index = 0; index < obstacles.size(); ++index) {
+    geometry::Polygon bounds = obstacles[index]->GetBounds();
+    for (unsigned side_index = 0; side_index < bounds.NumberOfSides();
+        ++side_index) {
+      grid_.AddBoundaryLine(boundaryLinesHolder_->
+          AddStraightBoundaryLine(bounds.GetSide(side_index), false));
+    }
+  }
+
+  for (unsigned index = 0; index < road_segments.size(); ++index) {
+    AddBoundaryLinesForObject(road_segments[index]);
+  }
+  for (unsigned index = 0; index < parking_lots.size(); ++index) {
+    AddBoundaryLinesForObject(parking_lots[index]);
+  }
+
+  RemoveSmallBoundaryLines();
+  grid_.BuildSegmentIndex();
+}
+
+void IntersectionHandler::FitGridToLayout(const ObjectHolder& object_holder) {
+  const RectangleObjectContainer* containers[] = {
+    &object_holder.GetRoadSegments(),
+    &object_holder.GetParkingLots(),
+    &object_holder.GetObstacles()
+  };
+  geometry::BoundingBox extent;
+  double sides_length = 0.0;
+  for (unsigned i = 0; i < sizeof(containers) / sizeof(containers[0]); ++i) {
+    for (unsigned index = 0; index < containers[i]->size(); ++index) {
+      const geometry::RectangleObject* object = (*containers[i])[index];
+      extent.UnionWith(object->GetBoundingBox());
+      sides_length += 2.0 * (object->GetFrom().GetDistance(object->GetTo()) +
+                             object->GetWidth());
+    }
+  }
+  if (extent.IsEmpty() || DoubleIsZero(sides_length)) {
+    return;
+  }
+
+  // The boundary lines may stick out of the objects by the gap tolerance.
+  extent = extent.GetExpanded(GAP_TOLERANCE + MIN_CELL_SIZE);
+  double width = extent.GetMaxX() - extent.GetMinX();
+  double height = extent.GetMaxY() - extent.GetMinY();
+  // A side of length L crosses about L / cell_size cells, so on average
+  // sides_length * cell_size / (width * height) sides cross a cell.
+  double cell_size = std::max(
+      SIDES_PER_CELL * width * height / sides_length, MIN_CELL_SIZE);
+  int vertical_cells = std::min(
+      MAX_CELLS, static_cast<int>(ceil(width / cell_size)));
+  int horizontal_cells = std::min(
+      MAX_CELLS, static_cast<int>(ceil(height / cell_size)));
+  grid_.Reset(extent.GetMinX(), extent.GetMaxX(),
+              extent.GetMinY(), extent.GetMaxY(),
+              vertical_cells, horizontal_cells);
+}
+
+void IntersectionHandler::GetBoundaryLines(
+    const geometry::BoundingBox& bounding_box,
+    std::vector<const geometry::BoundaryLine*>* result) const {
+  grid_.GetBoundaryLines(bounding_box, result);
+}
+
+void IntersectionHandler::GetBoundaryLines(
+    std::vector<const geometry::BoundaryLine*>* result) const {
+  grid_.GetBoundaryLines(result);
+}
+
+void IntersectionHandler::GetBoundarySegments(
+    const geometry::BoundingBox& bounding_box,
+    std::vector<geometry::SegmentSpan>* result) const {
+  grid_.GetBoundarySegments(bounding_box, result);
+}
+
+const geometry::Segment* IntersectionHandler::GetIntersectedBoundarySegment(
+    const geometry::Polygon& polygon,
+    std::vector<geometry::SegmentSpan>* spans) const {
+  grid_.GetBoundarySegments(polygon.GetBoundingBox(), spans);
+  return grid_.GetIntersectedSegment(polygon, *spans);
+}
+
+size_t IntersectionHandler::GetMemoryUsage() const {
+  return grid_.GetMemoryUsage();
+}
+
+void IntersectionHandler::AddBoundaryLinesForObject(
+    const geometry::RectangleObject* object){
+  const geometry::Polygon bounds = object->GetBounds();
+
+  std::vector<const geometry::RectangleObject*> objects;
+  std::vector<std::pair<double, double> > overlapped_intervals;
+  geometry::Polygon obj_bounds;
+  for (unsigned side_index = 0; side_index < bounds.NumberOfSides();
+      ++side_index) {
+    geometry::Segment segment = bounds.GetSide(side_index);
+
+    // The objects within the gap tolerance of the side are looked up too, so
+    // that the lines do not depend on the cells the objects share with it.
+    grid_.GetRectangleObjects(
+        segment.GetBoundingBox().GetExpanded(GAP_TOLERANCE), &objects);
+    
+    overlapped_intervals.clear();
+    for (unsigned index = 0; index < objects.size(); ++index) {
+      if (objects[index] == object) {
+        continue;
+      }
+      std::pair<double, double> interval;
+      objects[index]->GetBounds(&obj_bounds);
+      if (Intersect(obj_bounds, segment, &interval)) {
+        overlapped_intervals.push_back(interval);
+      }
+      
+      obj_bounds.Translate(bounds.GetSideNormal(side_index).Unit() * GAP_TOLERANCE);
+      if (Intersect(obj_bounds, segment, &interval)) {
+        overlapped_intervals.push_back(interval);
+      }
+    }
+    sort(overlapped_intervals.begin(), overlapped_intervals.end());
+    double current_fraction = 0.0;
+    for (unsigned index = 0; index < overlapped_intervals.size(); ++index) {
+      if (DoubleIsGreater(overlapped_intervals[index].first,
+          current_fraction)) {
+        geometry::Segment sub_segment(segment.SubSegment(current_fraction,
+            overlapped_intervals[index].first));
+
+        grid_.AddBoundaryLine(boundaryLinesHolder_->
+            AddStraightBoundaryLine(sub_segment, false));
+      }
+
+      current_fraction = std::max(current_fraction,
+          overlapped_intervals[index].second);
+    }
+
+    if (DoubleIsGreater(1.0, current_fraction)) {
+        geometry::Segment sub_segment(segment.SubSegment(current_fraction, 1.0));
+        grid_.AddBoundaryLine(boundaryLinesHolder_->
+            AddStraightBoundaryLine(sub_segment, false));
+    }
+  } 
+}
+
+void IntersectionHandler::RemoveSmallBoundaryLines() {
+  std::vector<const geometry::BoundaryLine*> boundary_lines;
+  grid_.GetBoundaryLines(&boundary_lines);
+  for (unsigned index = 0; index < boundary_lines.size(); ++index) {
+    if (DoubleIsGreater(boundary_lines[index]->GetLength(), GAP_TOLERANCE)) {
+      continue;
+    }
+    geometry::BoundingBox bounding_box = 
+        boundary_lines[index]->GetBoundingBox();
+    std::vector<const geometry::BoundaryLine*> neighbouring_lines;
+    grid_.GetBoundaryLines(bounding_box.GetExpanded(GAP_TOLERANCE), 
+        &neighbouring_lines);
+
+    bool has_long_neighbour = false;
+    for (unsigned neighbour_index = 0; neighbour_index <
+        neighbouring_lines.size(); ++neighbour_index) {
+      const geometry::BoundaryLine* neighbour =
+          neighbouring_lines[neighbour_index];
+      if (DoubleIsGreater(neighbour->GetLength(),GAP_TOLERANCE) && 
+          neighbour->GetBoundingBox().Intersect(bounding_box)) {
+        has_long_neighbour = true;
+        break;    
+      }   
+    }
+
+    if (!has_long_neighbour) {
+      grid_.RemoveBoundaryLine(boundary_lines[index]);
+    }
+  }
+}
+
 }  // namespace utils
\ No newline at end of file
@@ -1,39 +1,64 @@
-#ifndef CAR_SIMULATION_CAR_SIMULATION_INTERSECTION_HANDLER_H_
-#define CAR_SIMULATION_CAR_SIMULATION_INTERSECTION_HANDLER_H_
-
-#include "geometry/regular_grid.h"
-
-namespace geometry {
-class BoundingBox;
-class BoundaryLine;
-class Segment;
-}  // namespace geometry
-
-namespace utils {
-
-class ObjectHolder;
-class BoundaryLinesHolder;
-
-class IntersectionHandler {
- public:
-  IntersectionHandler(double minx, double maxx, double miny, double maxy,
-      BoundaryLinesHolder* boundary_lines_holder);
-
-  void Init(const ObjectHolder& object_holder);
-
-   void GetBoundaryLines(const geometry::BoundingBox& bounding_box, 
-      std::vector<const geometry::BoundaryLine*>* result) const;
-  
-   void GetBoundaryLines(std::vector<const geometry::BoundaryLine*>* result) const;
-
- private: 
-  void AddBoundaryLinesForObject(const geometry::RectangleObject* object);
-  void RemoveSmallBoundaryLines();
-
- private:
-  geometry::RegularGrid grid_;
-  BoundaryLinesHolder* boundaryLinesHolder_;
-};
-}  // namespace utils
-
-#endif  // CAR_SIMULATION_CAR_SIMULATION_INTERSECTION_HANDLER_H_
+#ifndef CAR_SIMULATION_CAR_SIMULATION_INTERSECTION_HANDLER_H_
+#define CAR_SIMULATION_CAR_SIMULATION_INTERSECTION_HANDLER_H_
+
+#include "geometry/regular_grid.h"
+
+namespace geometry {
+class BoundingBox;
+class BoundaryLine;
+class Polygon;
+class Segment;
+}  // namespace geometry
+
+namespace utils {
+
+class ObjectHolder;
+class BoundaryLinesHolder;
+
+class IntersectionHandler {
+ public:
+  IntersectionHandler(double minx, double maxx, double miny, double maxy,
+      BoundaryLinesHolder* boundary_lines_holder);
+
+  // By default Init fits the grid to the layout: it covers only the objects
+  // and its cells are sized after the density of their sides. When disabled
+  // the grid keeps the area and the cells it was constructed with.
+  void SetAdaptiveGrid(bool adaptive);
+  bool IsAdaptiveGrid() const;
+
+  void Init(const ObjectHolder& object_holder);
+
+   void GetBoundaryLines(const geometry::BoundingBox& bounding_box, 
+      std::vector<const geometry::BoundaryLine*>* result) const;
+  
+   void GetBoundaryLines(std::vector<const geometry::BoundaryLine*>* result) const;
+
+  // Same as GetBoundaryLines but returns the segments of the lines, read
+  // from a flat array without going through the BoundaryLine objects.
+  void GetBoundarySegments(const geometry::BoundingBox& bounding_box,
+      std::vector<geometry::SegmentSpan>* result) const;
+
+  // Returns a boundary segment crossing "polygon" or NULL if there is none.
+  // "spans" is a buffer owned by the caller and reused between the queries,
+  // so once it has grown the query does not allocate. After Init this and
+  // GetBoundarySegments may be called from several threads at once.
+  const geometry::Segment* GetIntersectedBoundarySegment(
+      const geometry::Polygon& polygon,
+      std::vector<geometry::SegmentSpan>* spans) const;
+
+  // The number of bytes allocated for the grid indexing the layout.
+  size_t GetMemoryUsage() const;
+
+ private: 
+  void FitGridToLayout(const ObjectHolder& object_holder);
+  void AddBoundaryLinesForObject(const geometry::RectangleObject* object);
+  void RemoveSmallBoundaryLines();
+
+ private:
+  geometry::RegularGrid grid_;
+  BoundaryLinesHolder* boundaryLinesHolder_;
+  bool adaptiveGrid_;
+};
+}  // namespace utils
+
+#endif  // CAR_SIMULATION_CAR_SIMULATION_INTERSECTION_HANDLER_H_
@@ -1,11 +1,11 @@
-#ifndef GLUT_UTILS_H
-#define GLUT_UTILS_H
-
-namespace visualize {
-
-// Initializes GLUT.
-void initGlut(int argc, char** argv);
-
-}  // namespace visualize
-
+#ifndef GLUT_UTILS_H
+#define GLUT_UTILS_H
+
+namespace visualize {
+
+// Initializes GLUT.
+void initGlut(int argc, char** argv);
+
+}  // namespace visualize
+
  #endif  // GLUT_UTILS_H
\ No newline at end of file
@@ -0,0 +1,70 @@
+// Converts layouts saved by ObjectHolder between the text and the binary
+// format. The format of every input file is recognized automatically and the
+// result is written next to it with the extension replaced by ".bin", or by
+// ".txt" if --text is given.
+//
+// Usage: layout_converter [--text] <layout file>...
+
+#include "utils/object_holder.h"
+
+#include <exception>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+static const char* BINARY_EXTENSION = ".bin";
+static const char* TEXT_EXTENSION = ".txt";
+
+string GetOutputPath(const string& input_path, const string& extension) {
+  string::size_type dot = input_path.find_last_of('.');
+  string::size_type slash = input_path.find_last_of("/\\");
+  if (dot == string::npos || (slash != string::npos && dot < slash)) {
+    return input_path + extension;
+  }
+  return input_path.substr(0, dot) + extension;
+}
+
+int main(int argc, char** argv) {
+  bool to_text = false;
+  vector<string> input_paths;
+  for (int i = 1; i < argc; ++i) {
+    string argument = argv[i];
+    if (argument == "--text") {
+      to_text = true;
+    } else {
+      input_paths.push_back(argument);
+    }
+  }
+  if (input_paths.empty()) {
+    cerr << "Usage: " << argv[0] << " [--text] <layout file>..." << endl;
+    return 1;
+  }
+
+  int failed = 0;
+  for (unsigned i = 0; i < input_paths.size(); ++i) {
+    string output_path = GetOutputPath(
+        input_paths[i], to_text ? TEXT_EXTENSION : BINARY_EXTENSION);
+    if (output_path == input_paths[i]) {
+      cerr << "Skipping " << input_paths[i]
+           << ": it is already in the requested format." << endl;
+      continue;
+    }
+    try {
+      utils::ObjectHolder object_holder;
+      object_holder.ParseFromFile(input_paths[i]);
+      if (to_text) {
+        object_holder.DumpToFile(output_path);
+      } else {
+        object_holder.DumpToBinaryFile(output_path);
+      }
+      cout << input_paths[i] << " -> " << output_path << endl;
+    } catch (const exception& e) {
+      cerr << "Could not convert " << input_paths[i] << ": " << e.what()
+           << endl;
+      ++failed;
+    }
+  }
+  return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,379 @@
+#include "geometry/segment_arrays.h"
+
+#include "geometry/point.h"
+#include "geometry/polygon.h"
+#include "geometry/segment.h"
+#include "geometry/vector.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// A target with AVX2 has SSE2 too, so all the narrower paths are compiled
+// as well and can be tested against each other.
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define SEGMENT_ARRAYS_AVX2
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SEGMENT_ARRAYS_SSE2
+#endif
+
+namespace geometry {
+
+// The separating axis test is done with this margin so that it never rejects
+// a segment Intersect would accept. The tolerances of Intersect are 1e-9 in
+// units of fractions and areas, which is far less than the margin for the
+// sizes of the objects in the world.
+static const double SEPARATION_MARGIN = 1e-4;
+
+// Tolerance of the check that a polygon is a rectangle.
+static const double RECTANGLE_TOLERANCE = 1e-9;
+
+void SegmentArrays::Clear() {
+  x0_.clear();
+  y0_.clear();
+  x1_.clear();
+  y1_.clear();
+}
+
+void SegmentArrays::Reserve(int size) {
+  x0_.reserve(size);
+  y0_.reserve(size);
+  x1_.reserve(size);
+  y1_.reserve(size);
+}
+
+void SegmentArrays::Add(const Segment& segment) {
+  x0_.push_back(segment.A().x);
+  y0_.push_back(segment.A().y);
+  x1_.push_back(segment.B().x);
+  y1_.push_back(segment.B().y);
+}
+
+int SegmentArrays::Size() const {
+  return x0_.size();
+}
+
+size_t SegmentArrays::GetMemoryUsage() const {
+  return (x0_.capacity() + y0_.capacity() + x1_.capacity() + y1_.capacity()) *
+      sizeof(double);
+}
+
+Segment SegmentArrays::GetSegment(int index) const {
+  return Segment(Point(x0_[index], y0_[index]), Point(x1_[index], y1_[index]));
+}
+
+const double* SegmentArrays::GetX0() const {
+  return x0_.empty() ? NULL : &x0_[0];
+}
+
+const double* SegmentArrays::GetY0() const {
+  return y0_.empty() ? NULL : &y0_[0];
+}
+
+const double* SegmentArrays::GetX1() const {
+  return x1_.empty() ? NULL : &x1_[0];
+}
+
+const double* SegmentArrays::GetY1() const {
+  return y1_.empty() ? NULL : &y1_[0];
+}
+
+// A rectangle given by its center, the unit vectors along its sides and half
+// of the lengths of the sides.
+struct RectangleFrame {
+  double centerX, centerY;
+  double ux, uy;
+  double vx, vy;
+  double halfLength, halfWidth;
+};
+
+// Fills "frame" and returns true if "polygon" is a rectangle.
+static bool GetRectangleFrame(const Polygon& polygon, RectangleFrame* frame) {
+  if (polygon.NumberOfVertices() != 4) {
+    return false;
+  }
+  const Point& p0 = polygon.GetPoint(0);
+  const Point& p1 = polygon.GetPoint(1);
+  const Point& p2 = polygon.GetPoint(2);
+  const Point& p3 = polygon.GetPoint(3);
+  Vector side1(p0, p1);
+  Vector side2(p1, p2);
+  double length1 = side1.Length();
+  double length2 = side2.Length();
+  if (length1 < RECTANGLE_TOLERANCE || length2 < RECTANGLE_TOLERANCE) {
+    return false;
+  }
+  double scale = std::max(length1, length2);
+  if (fabs(side1.DotProduct(side2)) > RECTANGLE_TOLERANCE * scale * scale ||
+      fabs(p0.x + side2.x - p3.x) > RECTANGLE_TOLERANCE * scale ||
+      fabs(p0.y + side2.y - p3.y) > RECTANGLE_TOLERANCE * scale) {
+    return false;
+  }
+  frame->centerX = (p0.x + p2.x) * 0.5;
+  frame->centerY = (p0.y + p2.y) * 0.5;
+  frame->ux = side1.x / length1;
+  frame->uy = side1.y / length1;
+  frame->vx = side2.x / length2;
+  frame->vy = side2.y / length2;
+  frame->halfLength = length1 * 0.5;
+  frame->halfWidth = length2 * 0.5;
+  return true;
+}
+
+// Returns false if the segment is separated from the rectangle by more than
+// the margin along one of the sides of the rectangle or the normal of the
+// segment.
+static bool MayIntersect(const RectangleFrame& frame,
+                         double x0, double y0, double x1, double y1) {
+  double dx0 = x0 - frame.centerX;
+  double dy0 = y0 - frame.centerY;
+  double dx1 = x1 - frame.centerX;
+  double dy1 = y1 - frame.centerY;
+
+  double u0 = dx0 * frame.ux + dy0 * frame.uy;
+  double u1 = dx1 * frame.ux + dy1 * frame.uy;
+  double max_u = frame.halfLength + SEPARATION_MARGIN;
+  if (std::min(u0, u1) > max_u || std::max(u0, u1) < -max_u) {
+    return false;
+  }
+
+  double v0 = dx0 * frame.vx + dy0 * frame.vy;
+  double v1 = dx1 * frame.vx + dy1 * frame.vy;
+  double max_v = frame.halfWidth + SEPARATION_MARGIN;
+  if (std::min(v0, v1) > max_v || std::max(v0, v1) < -max_v) {
+    return false;
+  }
+
+  // The projections are scaled by the length of the normal, so is the margin
+  // (|nx| + |ny| is not less than the length).
+  double nx = dy0 - dy1;
+  double ny = dx1 - dx0;
+  double distance = fabs(dx0 * nx + dy0 * ny);
+  double radius = frame.halfLength * fabs(frame.ux * nx + frame.uy * ny) +
+      frame.halfWidth * fabs(frame.vx * nx + frame.vy * ny) +
+      SEPARATION_MARGIN * (fabs(nx) + fabs(ny));
+  return !(distance > radius);
+}
+
+#if defined(SEGMENT_ARRAYS_AVX2)
+
+// Returns a bit mask of the segments [index, index + 4) which may intersect
+// the rectangle. Computes the same as MayIntersect.
+static int MayIntersectMaskAvx2(const RectangleFrame& frame,
+                                const SegmentArrays& segments, int index) {
+  const __m256d sign_mask = _mm256_set1_pd(-0.0);
+  __m256d center_x = _mm256_set1_pd(frame.centerX);
+  __m256d center_y = _mm256_set1_pd(frame.centerY);
+  __m256d dx0 = _mm256_sub_pd(_mm256_loadu_pd(segments.GetX0() + index),
+                              center_x);
+  __m256d dy0 = _mm256_sub_pd(_mm256_loadu_pd(segments.GetY0() + index),
+                              center_y);
+  __m256d dx1 = _mm256_sub_pd(_mm256_loadu_pd(segments.GetX1() + index),
+                              center_x);
+  __m256d dy1 = _mm256_sub_pd(_mm256_loadu_pd(segments.GetY1() + index),
+                              center_y);
+
+  __m256d ux = _mm256_set1_pd(frame.ux);
+  __m256d uy = _mm256_set1_pd(frame.uy);
+  __m256d u0 = _mm256_add_pd(_mm256_mul_pd(dx0, ux), _mm256_mul_pd(dy0, uy));
+  __m256d u1 = _mm256_add_pd(_mm256_mul_pd(dx1, ux), _mm256_mul_pd(dy1, uy));
+  __m256d max_u = _mm256_set1_pd(frame.halfLength + SEPARATION_MARGIN);
+  __m256d min_u = _mm256_set1_pd(-(frame.halfLength + SEPARATION_MARGIN));
+  __m256d separated = _mm256_or_pd(
+      _mm256_cmp_pd(_mm256_min_pd(u0, u1), max_u, _CMP_GT_OQ),
+      _mm256_cmp_pd(_mm256_max_pd(u0, u1), min_u, _CMP_LT_OQ));
+
+  __m256d vx = _mm256_set1_pd(frame.vx);
+  __m256d vy = _mm256_set1_pd(frame.vy);
+  __m256d v0 = _mm256_add_pd(_mm256_mul_pd(dx0, vx), _mm256_mul_pd(dy0, vy));
+  __m256d v1 = _mm256_add_pd(_mm256_mul_pd(dx1, vx), _mm256_mul_pd(dy1, vy));
+  __m256d max_v = _mm256_set1_pd(frame.halfWidth + SEPARATION_MARGIN);
+  __m256d min_v = _mm256_set1_pd(-(frame.halfWidth + SEPARATION_MARGIN));
+  separated = _mm256_or_pd(separated, _mm256_or_pd(
+      _mm256_cmp_pd(_mm256_min_pd(v0, v1), max_v, _CMP_GT_OQ),
+      _mm256_cmp_pd(_mm256_max_pd(v0, v1), min_v, _CMP_LT_OQ)));
+
+  __m256d nx = _mm256_sub_pd(dy0, dy1);
+  __m256d ny = _mm256_sub_pd(dx1, dx0);
+  __m256d distance = _mm256_andnot_pd(sign_mask,
+      _mm256_add_pd(_mm256_mul_pd(dx0, nx), _mm256_mul_pd(dy0, ny)));
+  __m256d along = _mm256_andnot_pd(sign_mask,
+      _mm256_add_pd(_mm256_mul_pd(ux, nx), _mm256_mul_pd(uy, ny)));
+  __m256d across = _mm256_andnot_pd(sign_mask,
+      _mm256_add_pd(_mm256_mul_pd(vx, nx), _mm256_mul_pd(vy, ny)));
+  __m256d normal = _mm256_add_pd(_mm256_andnot_pd(sign_mask, nx),
+                                 _mm256_andnot_pd(sign_mask, ny));
+  __m256d radius = _mm256_add_pd(
+      _mm256_add_pd(
+          _mm256_mul_pd(_mm256_set1_pd(frame.halfLength), along),
+          _mm256_mul_pd(_mm256_set1_pd(frame.halfWidth), across)),
+      _mm256_mul_pd(_mm256_set1_pd(SEPARATION_MARGIN), normal));
+  separated = _mm256_or_pd(separated,
+                           _mm256_cmp_pd(distance, radius, _CMP_GT_OQ));
+  return ~_mm256_movemask_pd(separated) & 0xf;
+}
+
+#endif
+
+#if defined(SEGMENT_ARRAYS_SSE2)
+
+// Returns a bit mask of the segments [index, index + 2) which may intersect
+// the rectangle. Computes the same as MayIntersect.
+static int MayIntersectMaskSse2(const RectangleFrame& frame,
+                                const SegmentArrays& segments, int index) {
+  const __m128d sign_mask = _mm_set1_pd(-0.0);
+  __m128d center_x = _mm_set1_pd(frame.centerX);
+  __m128d center_y = _mm_set1_pd(frame.centerY);
+  __m128d dx0 = _mm_sub_pd(_mm_loadu_pd(segments.GetX0() + index), center_x);
+  __m128d dy0 = _mm_sub_pd(_mm_loadu_pd(segments.GetY0() + index), center_y);
+  __m128d dx1 = _mm_sub_pd(_mm_loadu_pd(segments.GetX1() + index), center_x);
+  __m128d dy1 = _mm_sub_pd(_mm_loadu_pd(segments.GetY1() + index), center_y);
+
+  __m128d ux = _mm_set1_pd(frame.ux);
+  __m128d uy = _mm_set1_pd(frame.uy);
+  __m128d u0 = _mm_add_pd(_mm_mul_pd(dx0, ux), _mm_mul_pd(dy0, uy));
+  __m128d u1 = _mm_add_pd(_mm_mul_pd(dx1, ux), _mm_mul_pd(dy1, uy));
+  __m128d max_u = _mm_set1_pd(frame.halfLength + SEPARATION_MARGIN);
+  __m128d min_u = _mm_set1_pd(-(frame.halfLength + SEPARATION_MARGIN));
+  __m128d separated = _mm_or_pd(_mm_cmpgt_pd(_mm_min_pd(u0, u1), max_u),
+                                _mm_cmplt_pd(_mm_max_pd(u0, u1), min_u));
+
+  __m128d vx = _mm_set1_pd(frame.vx);
+  __m128d vy = _mm_set1_pd(frame.vy);
+  __m128d v0 = _mm_add_pd(_mm_mul_pd(dx0, vx), _mm_mul_pd(dy0, vy));
+  __m128d v1 = _mm_add_pd(_mm_mul_pd(dx1, vx), _mm_mul_pd(dy1, vy));
+  __m128d max_v = _mm_set1_pd(frame.halfWidth + SEPARATION_MARGIN);
+  __m128d min_v = _mm_set1_pd(-(frame.halfWidth + SEPARATION_MARGIN));
+  separated = _mm_or_pd(separated, _mm_or_pd(
+      _mm_cmpgt_pd(_mm_min_pd(v0, v1), max_v),
+      _mm_cmplt_pd(_mm_max_pd(v0, v1), min_v)));
+
+  __m128d nx = _mm_sub_pd(dy0, dy1);
+  __m128d ny = _mm_sub_pd(dx1, dx0);
+  __m128d distance = _mm_andnot_pd(sign_mask,
+      _mm_add_pd(_mm_mul_pd(dx0, nx), _mm_mul_pd(dy0, ny)));
+  __m128d along = _mm_andnot_pd(sign_mask,
+      _mm_add_pd(_mm_mul_pd(ux, nx), _mm_mul_pd(uy, ny)));
+  __m128d across = _mm_andnot_pd(sign_mask,
+      _mm_add_pd(_mm_mul_pd(vx, nx), _mm_mul_pd(vy, ny)));
+  __m128d normal = _mm_add_pd(_mm_andnot_pd(sign_mask, nx),
+                              _mm_andnot_pd(sign_mask, ny));
+  __m128d radius = _mm_add_pd(
+      _mm_add_pd(_mm_mul_pd(_mm_set1_pd(frame.halfLength), along),
+                 _mm_mul_pd(_mm_set1_pd(frame.halfWidth), across)),
+      _mm_mul_pd(_mm_set1_pd(SEPARATION_MARGIN), normal));
+  separated = _mm_or_pd(separated, _mm_cmpgt_pd(distance, radius));
+  return ~_mm_movemask_pd(separated) & 0x3;
+}
+
+#endif
+
+static bool IntersectsSegment(const Polygon& polygon,
+                              const SegmentArrays& segments, int index) {
+  return Intersect(polygon, segments.GetSegment(index), NULL);
+}
+
+// Checks the segments [*index, end) in groups of "lanes" filtered by
+// "may_intersect_mask" until fewer than "lanes" are left. Returns the first
+// intersected segment or -1 and leaves the first unchecked one in "index".
+// The lanes passing the filter are checked in order so the first intersected
+// segment is found.
+static int FindFirstIntersectedSegmentInGroups(
+    const Polygon& rectangle, const RectangleFrame& frame,
+    const SegmentArrays& segments, int lanes,
+    int (*may_intersect_mask)(const RectangleFrame&, const SegmentArrays&,
+                              int),
+    int* index, int end) {
+  for (; *index + lanes <= end; *index += lanes) {
+    int mask = may_intersect_mask(frame, segments, *index);
+    for (int lane = 0; mask != 0; ++lane, mask >>= 1) {
+      if ((mask & 1) &&
+          IntersectsSegment(rectangle, segments, *index + lane)) {
+        return *index + lane;
+      }
+    }
+  }
+  return -1;
+}
+
+bool IsSegmentFilterAvailable(SegmentFilter filter) {
+  switch (filter) {
+    case SCALAR_SEGMENT_FILTER:
+      return true;
+#if defined(SEGMENT_ARRAYS_SSE2)
+    case SSE2_SEGMENT_FILTER:
+      return true;
+#endif
+#if defined(SEGMENT_ARRAYS_AVX2)
+    case AVX2_SEGMENT_FILTER:
+      return true;
+#endif
+    default:
+      return false;
+  }
+}
+
+int FindFirstIntersectedSegment(const Polygon& rectangle,
+                                const SegmentArrays& segments,
+                                int begin, int end) {
+#if defined(SEGMENT_ARRAYS_AVX2)
+  return FindFirstIntersectedSegment(rectangle, segments, begin, end,
+                                     AVX2_SEGMENT_FILTER);
+#elif defined(SEGMENT_ARRAYS_SSE2)
+  return FindFirstIntersectedSegment(rectangle, segments, begin, end,
+                                     SSE2_SEGMENT_FILTER);
+#else
+  return FindFirstIntersectedSegment(rectangle, segments, begin, end,
+                                     SCALAR_SEGMENT_FILTER);
+#endif
+}
+
+int FindFirstIntersectedSegment(const Polygon& rectangle,
+                                const SegmentArrays& segments,
+                                int begin, int end, SegmentFilter filter) {
+  RectangleFrame frame;
+  if (!GetRectangleFrame(rectangle, &frame)) {
+    for (int index = begin; index < end; ++index) {
+      if (IntersectsSegment(rectangle, segments, index)) {
+        return index;
+      }
+    }
+    return -1;
+  }
+
+  int index = begin;
+  int intersected = -1;
+#if defined(SEGMENT_ARRAYS_AVX2)
+  if (filter == AVX2_SEGMENT_FILTER) {
+    intersected = FindFirstIntersectedSegmentInGroups(
+        rectangle, frame, segments, 4, MayIntersectMaskAvx2, &index, end);
+  }
+#endif
+#if defined(SEGMENT_ARRAYS_SSE2)
+  if (intersected == -1 &&
+      (filter == SSE2_SEGMENT_FILTER || filter == AVX2_SEGMENT_FILTER)) {
+    intersected = FindFirstIntersectedSegmentInGroups(
+        rectangle, frame, segments, 2, MayIntersectMaskSse2, &index, end);
+  }
+#endif
+  if (intersected != -1) {
+    return intersected;
+  }
+  const double* x0 = segments.GetX0();
+  const double* y0 = segments.GetY0();
+  const double* x1 = segments.GetX1();
+  const double* y1 = segments.GetY1();
+  for (; index < end; ++index) {
+    if (MayIntersect(frame, x0[index], y0[index], x1[index], y1[index]) &&
+        IntersectsSegment(rectangle, segments, index)) {
+      return index;
+    }
+  }
+  return -1;
+}
+
+}  // namespace geometry
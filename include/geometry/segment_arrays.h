@@ -0,0 +1,67 @@
+#ifndef INCLUDE_GEOMETRY_SEGMENT_ARRAYS_H_
+#define INCLUDE_GEOMETRY_SEGMENT_ARRAYS_H_
+
+#include <cstddef>
+#include <vector>
+
+namespace geometry {
+
+class Polygon;
+class Segment;
+
+// A list of segments kept as four arrays holding the coordinates of their
+// ends, so that several segments can be tested at once with SIMD
+// instructions.
+class SegmentArrays {
+ public:
+  void Clear();
+  void Reserve(int size);
+  void Add(const Segment& segment);
+
+  int Size() const;
+  Segment GetSegment(int index) const;
+
+  const double* GetX0() const;
+  const double* GetY0() const;
+  const double* GetX1() const;
+  const double* GetY1() const;
+
+  // The number of bytes allocated for the arrays.
+  size_t GetMemoryUsage() const;
+
+ private:
+  std::vector<double> x0_, y0_;
+  std::vector<double> x1_, y1_;
+};
+
+// Returns the index of the first segment in the interval [begin, end) which
+// intersects "rectangle" or -1 if there is none. The result is the same as
+// calling Intersect(rectangle, segment, NULL) for every segment in turn: the
+// segments are filtered with a separating axis test, vectorized with AVX2 or
+// SSE2 when the compiler targets them, and only the ones passing it are
+// checked with Intersect. Polygons other than rectangles are checked with
+// Intersect only.
+int FindFirstIntersectedSegment(const Polygon& rectangle,
+                                const SegmentArrays& segments,
+                                int begin, int end);
+
+// The implementations of the separating axis test. FindFirstIntersectedSegment
+// uses the widest one available.
+enum SegmentFilter {
+  SCALAR_SEGMENT_FILTER,
+  SSE2_SEGMENT_FILTER,
+  AVX2_SEGMENT_FILTER
+};
+
+// Returns true if "filter" was compiled for the target.
+bool IsSegmentFilterAvailable(SegmentFilter filter);
+
+// Same as FindFirstIntersectedSegment but filters the segments with "filter",
+// which should be available. All the filters give the same result.
+int FindFirstIntersectedSegment(const Polygon& rectangle,
+                                const SegmentArrays& segments,
+                                int begin, int end, SegmentFilter filter);
+
+}  // namespace geometry
+
+#endif  // INCLUDE_GEOMETRY_SEGMENT_ARRAYS_H_
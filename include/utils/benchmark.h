@@ -1,70 +1,92 @@
-#ifndef UTILS_BENCHMARK_H
-#define UTILS_BENCHMARK_H
-
-#define DO_BENCHMARK
-
-#include <vector>
-#include <string>
-
-namespace utils {
-class Benchmark {
- public:
-  struct BenchmarkItem {
-    BenchmarkItem() : totalTime(0.0), numberOfTimes(0) {}
-    BenchmarkItem(double total_time, int number_of_times) 
-        : totalTime(total_time), numberOfTimes(number_of_times) {}
-
-    double totalTime;
-    int numberOfTimes;
-    std::string name;
-  };
-  Benchmark(const std::string& function_name, int index);
-  ~Benchmark();
-
-  static void DumpBenchmarkingInfo();
-
-	static int gCounter_;
-  static int currentCounter_;
- private:
-  double startTime_;
-  int index_;
-  static std::vector<BenchmarkItem> timeTable_;
-};
-
-#define UPDATE_COUNTER()   {\
-                        static int _this_counter_ = 0;\
-                        static int _cur_counter = 0;\
-                        if (_this_counter_ == 0) {\
-                           _cur_counter = utils::Benchmark::gCounter_;\
-                           utils::Benchmark::gCounter_++;\
-                           _this_counter_ = 1;\
-                        }\
-                        utils::Benchmark::currentCounter_ = _cur_counter;\
-                     }
-
-
-#define CONCATENATE_DIRECT(s1, s2) s1##s2
-#define CONCATENATE(s1, s2) CONCATENATE_DIRECT(s1, s2)
-#define ANONYMOUS_VARIABLE(str) CONCATENATE(str, __LINE__)
-
-#define STRINGIFY(x) #x
-#define TOSTRING(x) STRINGIFY(x)
-
-#ifdef DO_BENCHMARK
-
-#define BENCHMARK_SCOPE UPDATE_COUNTER();\
-  utils::Benchmark ANONYMOUS_VARIABLE(bm)(\
-    std::string(__FILE__) + ":"  + std::string(__FUNCTION__) +\
-    "("TOSTRING(__LINE__)")", utils::Benchmark::currentCounter_)
-
-#define BENCHMARK_STR(x) UPDATE_COUNTER();\
-  utils::Benchmark ANONYMOUS_VARIABLE(bm)(\
-    std::string(__FILE__) + ":"  + std::string(__FUNCTION__)  +\
-    "("TOSTRING(__LINE__)") [" + x + "]", utils::Benchmark::currentCounter_)
-
-#else
-#define BENCHMARK_SCOPE
-#define BENCHMARK_STR(x)
-#endif
-}  // namespace utils
-#endif // UTILS_BENCHMARK_H
+#ifndef UTILS_BENCHMARK_H
+#define UTILS_BENCHMARK_H
+
+#define DO_BENCHMARK
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <string>
+
+namespace utils {
+// Accumulates the time spent in the benchmarked scopes. Every thread records
+// its measurements in a table of its own, so benchmarked code may run on
+// several threads at once. The tables are merged when dumped. Scopes are
+// timed with the monotonic wall clock, so the processor time of the other
+// threads is not added to them.
+class Benchmark {
+ public:
+  struct BenchmarkItem {
+    BenchmarkItem() : totalTime(0.0), numberOfTimes(0) {}
+    BenchmarkItem(double total_time, int number_of_times) 
+        : totalTime(total_time), numberOfTimes(number_of_times) {}
+
+    double totalTime;
+    int numberOfTimes;
+    std::string name;
+  };
+  Benchmark(const std::string& function_name, int index);
+  ~Benchmark();
+
+  // Returns the index of a new benchmarked scope.
+  static int GetNewCounter();
+
+  // Increments the number of times of the scope with index "index" without
+  // measuring any time. The name of the scope is made of the given parts
+  // the first time it is counted.
+  static void Count(const char* file, const char* function, int line,
+                    const char* label, int index);
+
+  // Should not be called while other threads run benchmarked code.
+  static void DumpBenchmarkingInfo();
+
+ private:
+  static std::vector<BenchmarkItem>* GetThreadTimeTable();
+
+ private:
+  double startTime_;
+  int index_;
+  std::vector<BenchmarkItem>* timeTable_;
+
+  static std::atomic<int> gCounter_;
+  static std::mutex timeTablesMutex_;
+  static std::vector<std::vector<BenchmarkItem>*> timeTables_;
+};
+
+#define CONCATENATE_DIRECT(s1, s2) s1##s2
+#define CONCATENATE(s1, s2) CONCATENATE_DIRECT(s1, s2)
+#define ANONYMOUS_VARIABLE(str) CONCATENATE(str, __LINE__)
+
+#define STRINGIFY(x) #x
+#define TOSTRING(x) STRINGIFY(x)
+
+// The index of every benchmarked scope is assigned the first time the scope
+// is entered. Initialization of local statics is thread-safe.
+#define UPDATE_COUNTER() static const int ANONYMOUS_VARIABLE(_bm_counter_) =\
+    utils::Benchmark::GetNewCounter()
+
+#ifdef DO_BENCHMARK
+
+#define BENCHMARK_SCOPE UPDATE_COUNTER();\
+  utils::Benchmark ANONYMOUS_VARIABLE(bm)(\
+    std::string(__FILE__) + ":"  + std::string(__FUNCTION__) +\
+    "(" TOSTRING(__LINE__) ")", ANONYMOUS_VARIABLE(_bm_counter_))
+
+#define BENCHMARK_STR(x) UPDATE_COUNTER();\
+  utils::Benchmark ANONYMOUS_VARIABLE(bm)(\
+    std::string(__FILE__) + ":"  + std::string(__FUNCTION__)  +\
+    "(" TOSTRING(__LINE__) ") [" + x + "]", ANONYMOUS_VARIABLE(_bm_counter_))
+
+// Counts how many times it is reached, e.g. to report how many candidates a
+// filter rejects. Cheaper than BENCHMARK_STR as it does not read the clock.
+#define BENCHMARK_COUNT(x) do { UPDATE_COUNTER();\
+  utils::Benchmark::Count(__FILE__, __FUNCTION__, __LINE__, x,\
+    ANONYMOUS_VARIABLE(_bm_counter_)); } while (false)
+
+#else
+#define BENCHMARK_SCOPE
+#define BENCHMARK_STR(x)
+#define BENCHMARK_COUNT(x) do {} while (false)
+#endif
+}  // namespace utils
+#endif // UTILS_BENCHMARK_H
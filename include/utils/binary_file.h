@@ -0,0 +1,81 @@
+#ifndef INCLUDE_UTILS_BINARY_FILE_H_
+#define INCLUDE_UTILS_BINARY_FILE_H_
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace utils {
+
+class MappedFile;
+
+// The saved graphs and manuever libraries are a header followed by arrays,
+// each of them padded to a multiple of BINARY_FILE_ALIGNMENT bytes so that
+// all the arrays of a mapped file are aligned for direct access. The numbers
+// are stored in the byte order of the machine that saved the file.
+static const size_t BINARY_FILE_ALIGNMENT = 8;
+
+// The hash of no bytes, to start a hash computed with HashBytes.
+static const unsigned long long HASH_OFFSET_BASIS = 14695981039346656037ULL;
+
+// Continues the 64 bit FNV-1a hash "hash" with "size" bytes of "data".
+unsigned long long HashBytes(const void* data, size_t size,
+                             unsigned long long hash);
+
+unsigned long long HashDouble(double value, unsigned long long hash);
+
+// @return the number of bytes padding an array of "size" bytes.
+size_t GetBinaryFilePadding(size_t size);
+
+// Writes "values" followed by their padding to "out".
+template<class T>
+void WriteArray(const std::vector<T>& values, std::ostream& out) {
+  static const char PADDING[BINARY_FILE_ALIGNMENT] = {0};
+  size_t size = values.size() * sizeof(T);
+  if (size > 0) {
+    out.write(reinterpret_cast<const char*>(&values[0]), size);
+  }
+  out.write(PADDING, GetBinaryFilePadding(size));
+}
+
+// Reads the arrays of a mapped binary file in place.
+class BinaryFileReader {
+ public:
+  // "truncated_message" is the message of the std::runtime_error thrown
+  // when the file ends before an array.
+  BinaryFileReader(const MappedFile& file,
+                   const std::string& truncated_message);
+
+  // Returns the next "count" values and skips their padding.
+  template<class T>
+  const T* Read(int count) {
+    size_t size = static_cast<size_t>(count) * sizeof(T);
+    const T* values = reinterpret_cast<const T*>(data_ + offset_);
+    Skip(count < 0, size);
+    return values;
+  }
+
+  template<class T>
+  void ReadArray(int count, std::vector<T>* values) {
+    const T* begin = Read<T>(count);
+    values->assign(begin, begin + count);
+  }
+
+  bool AtEnd() const;
+
+ private:
+  // Moves past "size" bytes and their padding. Throws if "invalid" or if the
+  // file ends before them.
+  void Skip(bool invalid, size_t size);
+
+ private:
+  const char* data_;
+  size_t size_;
+  size_t offset_;
+  std::string truncatedMessage_;
+};
+
+}  // namespace utils
+
+#endif  // INCLUDE_UTILS_BINARY_FILE_H_
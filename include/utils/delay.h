@@ -1,7 +1,10 @@
-#ifndef INCLUDE_UTILS_DELAY_H_
-#define INCLUDE_UTILS_DELAY_H_
-
-double get_time();
-void delay(double seconds);
-
-#endif  // INCLUDE_UTILS_DELAY_H_
+#ifndef INCLUDE_UTILS_DELAY_H_
+#define INCLUDE_UTILS_DELAY_H_
+
+double get_time();
+// Wall clock time in seconds. Unlike get_time() it does not add up the
+// processor time of all threads.
+double get_wall_time();
+void delay(double seconds);
+
+#endif  // INCLUDE_UTILS_DELAY_H_
@@ -0,0 +1,38 @@
+#ifndef INCLUDE_UTILS_MAPPED_FILE_H_
+#define INCLUDE_UTILS_MAPPED_FILE_H_
+
+#include <cstddef>
+#include <string>
+
+namespace utils {
+
+// A file mapped read-only into memory. The pages are read from the disk only
+// when they are first accessed. The data starts at a page boundary, so
+// sections of the file aligned to 8 bytes may be accessed in place.
+class MappedFile {
+ public:
+  // Throws std::runtime_error if the file can not be opened or mapped.
+  explicit MappedFile(const std::string& path);
+  ~MappedFile();
+
+  const char* GetData() const;
+  size_t GetSize() const;
+
+ private:
+  MappedFile(const MappedFile&);
+  MappedFile& operator=(const MappedFile&);
+
+ private:
+  const char* data_;
+  size_t size_;
+#ifdef _WIN32
+  void* file_;
+  void* mapping_;
+#else
+  int file_;
+#endif
+};
+
+}  // namespace utils
+
+#endif  // INCLUDE_UTILS_MAPPED_FILE_H_
@@ -0,0 +1,64 @@
+#ifndef INCLUDE_UTILS_THREAD_POOL_H_
+#define INCLUDE_UTILS_THREAD_POOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace utils {
+
+// Work that is split into independent tasks which may be run in parallel.
+class ParallelTask {
+ public:
+  virtual ~ParallelTask() {}
+
+  // Runs the task with index "task_index". "thread_index" is in the interval
+  // [0, number of threads) and identifies the thread running the task so that
+  // implementations can keep per-thread state without locking.
+  virtual void Run(int task_index, int thread_index) = 0;
+};
+
+// A fixed set of worker threads that run ParallelTasks. The thread calling
+// ParallelFor takes part in the work as well, so a pool with a single thread
+// runs everything serially on the calling thread.
+class ThreadPool {
+ public:
+  // @param number_of_threads - the number of threads running tasks including
+  //     the calling one. Pass 0 to use the number of hardware threads.
+  explicit ThreadPool(int number_of_threads);
+  ~ThreadPool();
+
+  int GetNumberOfThreads() const;
+
+  // Runs task->Run(index, thread_index) for every index in the interval
+  // [0, number_of_tasks) and returns when all of them are finished. Tasks are
+  // handed out to the threads one at a time so the order in which they run is
+  // not defined. If a task throws, the remaining tasks are skipped and the
+  // first exception is rethrown here.
+  void ParallelFor(int number_of_tasks, ParallelTask* task);
+
+ private:
+  void WorkerLoop(int thread_index);
+  void RunTasks(int thread_index);
+
+ private:
+  std::vector<std::thread> workers_;
+  std::mutex mutex_;
+  std::condition_variable workAvailable_;
+  std::condition_variable workFinished_;
+
+  ParallelTask* task_;
+  int numberOfTasks_;
+  std::atomic<int> nextTask_;
+  int busyWorkers_;
+  unsigned generation_;
+  bool stopping_;
+  std::exception_ptr error_;
+};
+
+}  // namespace utils
+
+#endif  // INCLUDE_UTILS_THREAD_POOL_H_
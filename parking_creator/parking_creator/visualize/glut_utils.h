@@ -1,11 +1,11 @@
-#ifndef PARKING_CREATOR_PARKING_CREATOR_GLUT_UTILS_H_
-#define PARKING_CREATOR_PARKING_CREATOR_GLUT_UTILS_H_
-
-namespace visualize {
-
-// Initializes GLUT.
-void initGlut(int argc, char** argv);
-
-}  // namespace visualize
-
-#endif  // PARKING_CREATOR_PARKING_CREATOR_GLUT_UTILS_H_
+#ifndef PARKING_CREATOR_PARKING_CREATOR_GLUT_UTILS_H_
+#define PARKING_CREATOR_PARKING_CREATOR_GLUT_UTILS_H_
+
+namespace visualize {
+
+// Initializes GLUT.
+void initGlut(int argc, char** argv);
+
+}  // namespace visualize
+
+#endif  // PARKING_CREATOR_PARKING_CREATOR_GLUT_UTILS_H_
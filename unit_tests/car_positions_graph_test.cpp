@@ -0,0 +1,291 @@
+#include "simulation/car_positions_graph.h"
+
+#include "geometry/geometry_utils.h"
+#include "geometry/point.h"
+#include "geometry/rectangle_object.h"
+#include "geometry/vector.h"
+#include "simulation/car_description.h"
+#include "simulation/car_manuever.h"
+#include "simulation/car_movement_handler.h"
+#include "simulation/car_position.h"
+#include "unit_tests/test_base.h"
+#include "utils/boundary_line_holder.h"
+#include "utils/car_positions_graph_builder.h"
+#include "utils/intersection_handler.h"
+#include "utils/object_holder.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <set>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+static const char* LAYOUT_FILE = "../resources/parking_serialized_turn.txt";
+static const char* CACHE_FILE = "car_positions_graph_test.bin";
+
+// Checks that a graph saved to the cache is restored as it was built and
+// that the cache is not used for another graph, and that the candidates the
+// edges are searched among do not miss any manuever.
+class TestCarPositionsGraph {
+ public:
+  static void RunTests();
+  static void TestCacheRoundTrip();
+  static void TestKeyDependsOnGrid();
+  static void TestEdgesMatchAllPairs();
+
+ private:
+  struct Layout {
+    explicit Layout(bool adaptive_grid)
+      : intersectionHandler(-250.0, 250.0, -150.0, 150.0,
+                            &boundaryLinesHolder) {
+      objectHolder.ParseFromFile(LAYOUT_FILE);
+      intersectionHandler.SetAdaptiveGrid(adaptive_grid);
+      intersectionHandler.Init(objectHolder);
+    }
+
+    utils::ObjectHolder objectHolder;
+    utils::BoundaryLinesHolder boundaryLinesHolder;
+    utils::IntersectionHandler intersectionHandler;
+  };
+
+  static simulation::CarDescription GetCarDescription();
+  // Adds starts[begin] to starts[end - 1] to "graph" on their objects.
+  static void AddStartPositions(Layout* layout,
+                                const vector<simulation::CarPosition>& starts,
+                                int begin, int end,
+                                simulation::CarPositionsGraph* graph);
+  static void CheckSameGraphs(const simulation::CarPositionsGraph& built,
+                              const simulation::CarPositionsGraph& loaded);
+};
+
+// static
+void TestCarPositionsGraph::RunTests() {
+  TestCacheRoundTrip();
+  TestKeyDependsOnGrid();
+  TestEdgesMatchAllPairs();
+}
+
+// static
+void TestCarPositionsGraph::TestCacheRoundTrip() {
+  remove(CACHE_FILE);
+  Layout layout(true);
+  simulation::CarMovementHandler movement_handler(
+      &layout.intersectionHandler, GetCarDescription());
+  utils::CarPositionsGraphBuilder builder(layout.objectHolder,
+                                          layout.intersectionHandler);
+  builder.SetComputeEdgesEagerly(true);
+  builder.SetLayoutFile(LAYOUT_FILE);
+
+  // The builder refers to the roads and then the parking lots by index.
+  const utils::RectangleObjectContainer& roads =
+      layout.objectHolder.GetRoadSegments();
+  const utils::RectangleObjectContainer& parking_lots =
+      layout.objectHolder.GetParkingLots();
+  vector<const geometry::RectangleObject*> layout_objects(roads.begin(),
+                                                          roads.end());
+  layout_objects.insert(layout_objects.end(), parking_lots.begin(),
+                        parking_lots.end());
+
+  // The start positions are turned off the sampling lattice.
+  simulation::CarPositionsGraph layout_graph(&movement_handler);
+  builder.CreateCarPositionsGraph(&layout_graph);
+  ASSERT(layout_graph.IsFrozen());
+  vector<simulation::CarPosition> starts;
+  for (int index = 0; index < 3; ++index) {
+    simulation::CarPosition position = layout_graph.GetPosition(
+        (2 * index + 1) * layout_graph.GetNumberOfVertices() / 6);
+    position.SetDirection(position.GetDirection().Rotate(0.1));
+    starts.push_back(position);
+  }
+
+  // A graph saved with start positions is restored with them.
+  simulation::CarPositionsGraph built(&movement_handler);
+  AddStartPositions(&layout, starts, 0, 2, &built);
+  unsigned long long key = builder.GetGraphKey(built);
+  builder.CreateCarPositionsGraph(&built);
+  built.SaveFrozenGraph(CACHE_FILE, key, layout_objects);
+  simulation::CarPositionsGraph loaded(&movement_handler);
+  AddStartPositions(&layout, starts, 0, 2, &loaded);
+  loaded.LoadFrozenGraph(CACHE_FILE, key, layout_objects);
+  CheckSameGraphs(built, loaded);
+  ASSERT(built.GetEdgesEnd(1) > 0);
+
+  // The saved file does not depend on the start positions, so a graph saved
+  // without them is restored with them too.
+  layout_graph.SaveFrozenGraph(CACHE_FILE, key, layout_objects);
+  simulation::CarPositionsGraph loaded_from_layout(&movement_handler);
+  AddStartPositions(&layout, starts, 0, 2, &loaded_from_layout);
+  loaded_from_layout.LoadFrozenGraph(CACHE_FILE, key, layout_objects);
+  CheckSameGraphs(built, loaded_from_layout);
+
+  // Other start positions are connected as a build would connect them.
+  simulation::CarPositionsGraph other_built(&movement_handler);
+  AddStartPositions(&layout, starts, 2, 3, &other_built);
+  ASSERT_EQUALS(key, builder.GetGraphKey(other_built));
+  builder.CreateCarPositionsGraph(&other_built);
+  simulation::CarPositionsGraph other_loaded(&movement_handler);
+  AddStartPositions(&layout, starts, 2, 3, &other_loaded);
+  other_loaded.LoadFrozenGraph(CACHE_FILE, key, layout_objects);
+  CheckSameGraphs(other_built, other_loaded);
+  ASSERT_NOT_EQUALS(builder.GetGraphKeyWithFixedPositions(built),
+                    builder.GetGraphKeyWithFixedPositions(other_built));
+
+  bool rejected = false;
+  try {
+    simulation::CarPositionsGraph other(&movement_handler);
+    other.LoadFrozenGraph(CACHE_FILE, key + 1, layout_objects);
+  } catch (const runtime_error&) {
+    rejected = true;
+  }
+  ASSERT(rejected);
+  remove(CACHE_FILE);
+}
+
+// static
+void TestCarPositionsGraph::TestKeyDependsOnGrid() {
+  Layout adaptive(true), fixed(false);
+  simulation::CarMovementHandler movement_handler(
+      &adaptive.intersectionHandler, GetCarDescription());
+  simulation::CarPositionsGraph graph(&movement_handler);
+  utils::CarPositionsGraphBuilder adaptive_builder(
+      adaptive.objectHolder, adaptive.intersectionHandler);
+  utils::CarPositionsGraphBuilder fixed_builder(
+      fixed.objectHolder, fixed.intersectionHandler);
+  adaptive_builder.SetLayoutFile(LAYOUT_FILE);
+  fixed_builder.SetLayoutFile(LAYOUT_FILE);
+  ASSERT_NOT_EQUALS(adaptive_builder.GetGraphKey(graph),
+                    fixed_builder.GetGraphKey(graph));
+}
+
+// static
+void TestCarPositionsGraph::TestEdgesMatchAllPairs() {
+  // Without an intersection handler every manuever is possible, so the edges
+  // depend only on which pairs of positions are tried.
+  simulation::CarMovementHandler movement_handler(NULL, GetCarDescription());
+  simulation::CarPositionsGraph graph(&movement_handler);
+  geometry::RectangleObject first_road(geometry::Point(-5.0, 0.0),
+                                       geometry::Point(25.0, 0.0), 3.4);
+  geometry::RectangleObject second_road(geometry::Point(10.0, -10.0),
+                                        geometry::Point(10.0, 10.0), 3.4);
+  // The positions on the lattice of the builder and some with arbitrary
+  // headings.
+  const double pi = geometry::GeometryUtils::PI;
+  for (int x = 0; x <= 20; x += 2) {
+    for (int heading = 0; heading < 20; ++heading) {
+      simulation::CarPosition position;
+      position.SetCenter(geometry::Point(x, 0.0));
+      position.SetDirection(geometry::Vector(cos(heading * pi / 10.0),
+                                             sin(heading * pi / 10.0)));
+      graph.AddPosition(position, &first_road);
+    }
+  }
+  srand(1);
+  for (int index = 0; index < 200; ++index) {
+    double angle = 2.0 * pi * rand() / RAND_MAX;
+    simulation::CarPosition position;
+    position.SetCenter(geometry::Point(10.0 + 2.0 * rand() / RAND_MAX - 1.0,
+                                       20.0 * rand() / RAND_MAX - 10.0));
+    position.SetDirection(geometry::Vector(cos(angle), sin(angle)));
+    graph.AddPosition(position, &second_road);
+  }
+  graph.FinalizeGraphEagerly(NULL);
+
+  int number_of_vertices = graph.GetNumberOfVertices();
+  set<pair<int, int> > edges;
+  for (int index = 0; index < number_of_vertices; ++index) {
+    for (int edge = graph.GetEdgesBegin(index);
+         edge < graph.GetEdgesEnd(index); ++edge) {
+      edges.insert(make_pair(index, graph.GetEdgeTarget(edge)));
+    }
+  }
+
+  // Every pair within the reach is connected if a manuever joins it in
+  // either direction.
+  set<pair<int, int> > expected_edges;
+  simulation::CarMovementContext context;
+  for (int first = 0; first < number_of_vertices; ++first) {
+    simulation::CarPosition car = graph.GetPosition(first);
+    for (int second = first + 1; second < number_of_vertices; ++second) {
+      simulation::CarPosition car2 = graph.GetPosition(second);
+      if (car.GetCenter().GetDistance(car2.GetCenter()) >
+          graph.GetManueverReach()) {
+        continue;
+      }
+      simulation::CarManuever manuever;
+      if (movement_handler.SingleManueverBetweenStates(car, car2, manuever,
+                                                       &context) ||
+          movement_handler.SingleManueverBetweenStates(car2, car, manuever,
+                                                       &context)) {
+        expected_edges.insert(make_pair(first, second));
+        expected_edges.insert(make_pair(second, first));
+      }
+    }
+  }
+  ASSERT(!expected_edges.empty());
+  ASSERT(edges == expected_edges);
+}
+
+// static
+simulation::CarDescription TestCarPositionsGraph::GetCarDescription() {
+  return simulation::CarDescription(
+      1.71, 4.52, geometry::GeometryUtils::DegreesToRadians(33.75));
+}
+
+// static
+void TestCarPositionsGraph::AddStartPositions(
+    Layout* layout, const vector<simulation::CarPosition>& starts,
+    int begin, int end, simulation::CarPositionsGraph* graph) {
+  for (int index = begin; index < end; ++index) {
+    utils::RectangleObjectContainer objects;
+    layout->objectHolder.GetObectsForLocation(starts[index].GetCenter(),
+                                              &objects);
+    ASSERT(!objects.empty());
+    graph->AddPosition(starts[index], objects.front());
+  }
+}
+
+// static
+void TestCarPositionsGraph::CheckSameGraphs(
+    const simulation::CarPositionsGraph& built,
+    const simulation::CarPositionsGraph& loaded) {
+  ASSERT(loaded.IsFrozen());
+  ASSERT_EQUALS(built.GetNumberOfVertices(), loaded.GetNumberOfVertices());
+  if (built.GetNumberOfVertices() != loaded.GetNumberOfVertices()) {
+    return;
+  }
+  for (int index = 0; index < built.GetNumberOfVertices(); ++index) {
+    simulation::CarPosition built_position = built.GetPosition(index);
+    simulation::CarPosition loaded_position = loaded.GetPosition(index);
+    ASSERT_EQUALS(built_position.GetCenter().x, loaded_position.GetCenter().x);
+    ASSERT_EQUALS(built_position.GetCenter().y, loaded_position.GetCenter().y);
+    ASSERT_EQUALS(built_position.GetDirection().x,
+                  loaded_position.GetDirection().x);
+    ASSERT_EQUALS(built_position.GetDirection().y,
+                  loaded_position.GetDirection().y);
+    ASSERT_EQUALS(built.IsPositionFinal(index), loaded.IsPositionFinal(index));
+    ASSERT_EQUALS(built.GetEdgesBegin(index), loaded.GetEdgesBegin(index));
+    ASSERT_EQUALS(built.GetEdgesEnd(index), loaded.GetEdgesEnd(index));
+  }
+  int number_of_edges = built.GetEdgesEnd(built.GetNumberOfVertices() - 1);
+  ASSERT(number_of_edges > 0);
+  for (int edge = 0; edge < number_of_edges; ++edge) {
+    ASSERT_EQUALS(built.GetEdgeTarget(edge), loaded.GetEdgeTarget(edge));
+    ASSERT_EQUALS(built.GetEdgeCost(edge), loaded.GetEdgeCost(edge));
+    simulation::CarManuever built_manuever = built.GetEdgeManuever(edge);
+    simulation::CarManuever loaded_manuever = loaded.GetEdgeManuever(edge);
+    ASSERT_EQUALS(built_manuever.GetTotalDistance(),
+                  loaded_manuever.GetTotalDistance());
+    ASSERT_EQUALS(built_manuever.IsReversed(), loaded_manuever.IsReversed());
+    ASSERT(built_manuever.GetBeginPosition().GetCenter() ==
+           loaded_manuever.GetBeginPosition().GetCenter());
+  }
+}
+
+int main() {
+  TestCarPositionsGraph::RunTests();
+  return 0;
+}
@@ -0,0 +1,141 @@
+#include "utils/intersection_handler.h"
+
+#include "geometry/boundary_line.h"
+#include "geometry/geometry_utils.h"
+#include "geometry/point.h"
+#include "geometry/polygon.h"
+#include "geometry/straight_boundary_line.h"
+#include "geometry/vector.h"
+#include "simulation/car_description.h"
+#include "simulation/car_position.h"
+#include "unit_tests/test_base.h"
+#include "utils/boundary_line_holder.h"
+#include "utils/object_holder.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace std;
+
+static const char* LAYOUT_FILE = "../resources/parking_serialized.txt";
+static const int NUMBER_OF_QUERIES = 20000;
+
+// The adaptive grid should only change how the boundary lines are indexed,
+// so both grids should produce the same lines and answer the same queries.
+class TestIntersectionHandler {
+ public:
+  static void RunTests();
+  static void TestSameBoundaryLines();
+  static void TestSameIntersections();
+
+ private:
+  struct Layout {
+    Layout()
+      : intersectionHandler(-250.0, 250.0, -150.0, 150.0,
+                            &boundaryLinesHolder) {}
+
+    utils::ObjectHolder objectHolder;
+    utils::BoundaryLinesHolder boundaryLinesHolder;
+    utils::IntersectionHandler intersectionHandler;
+  };
+
+  static void InitLayout(bool adaptive_grid, Layout* layout);
+  static void GetSortedSegments(const Layout& layout,
+                                vector<vector<double> >* segments);
+};
+
+// static
+void TestIntersectionHandler::RunTests() {
+  TestSameBoundaryLines();
+  TestSameIntersections();
+}
+
+// static
+void TestIntersectionHandler::TestSameBoundaryLines() {
+  Layout adaptive, fixed;
+  InitLayout(true, &adaptive);
+  InitLayout(false, &fixed);
+
+  vector<vector<double> > adaptive_segments, fixed_segments;
+  GetSortedSegments(adaptive, &adaptive_segments);
+  GetSortedSegments(fixed, &fixed_segments);
+  ASSERT(!adaptive_segments.empty());
+  ASSERT_EQUALS(adaptive_segments.size(), fixed_segments.size());
+  if (adaptive_segments.size() != fixed_segments.size()) {
+    return;
+  }
+  for (unsigned i = 0; i < adaptive_segments.size(); ++i) {
+    for (unsigned j = 0; j < 4; ++j) {
+      ASSERT_DOUBLE_EQUALS(adaptive_segments[i][j], fixed_segments[i][j]);
+    }
+  }
+}
+
+// static
+void TestIntersectionHandler::TestSameIntersections() {
+  Layout adaptive, fixed;
+  InitLayout(true, &adaptive);
+  InitLayout(false, &fixed);
+
+  simulation::CarDescription description(1.71, 4.52, 0.5);
+  vector<geometry::SegmentSpan> spans;
+  int blocked = 0;
+  srand(1);
+  for (int i = 0; i < NUMBER_OF_QUERIES; ++i) {
+    double x = -60.0 + 120.0 * rand() / RAND_MAX;
+    double y = -40.0 + 80.0 * rand() / RAND_MAX;
+    double angle = 2.0 * geometry::GeometryUtils::PI * rand() / RAND_MAX;
+    simulation::CarPosition position;
+    position.SetCenter(geometry::Point(x, y));
+    position.SetDirection(geometry::Vector(cos(angle), sin(angle)));
+    geometry::Polygon bounds;
+    description.GetBounds(position, bounds);
+
+    bool adaptive_blocked = adaptive.intersectionHandler.
+        GetIntersectedBoundarySegment(bounds, &spans) != NULL;
+    bool fixed_blocked = fixed.intersectionHandler.
+        GetIntersectedBoundarySegment(bounds, &spans) != NULL;
+    ASSERT_EQUALS(adaptive_blocked, fixed_blocked);
+    if (adaptive_blocked) {
+      ++blocked;
+    }
+  }
+  // Both the free and the blocked positions should have been covered.
+  ASSERT(blocked > 0);
+  ASSERT(blocked < NUMBER_OF_QUERIES);
+}
+
+// static
+void TestIntersectionHandler::InitLayout(bool adaptive_grid, Layout* layout) {
+  layout->objectHolder.ParseFromFile(LAYOUT_FILE);
+  layout->intersectionHandler.SetAdaptiveGrid(adaptive_grid);
+  layout->intersectionHandler.Init(layout->objectHolder);
+}
+
+// static
+void TestIntersectionHandler::GetSortedSegments(
+    const Layout& layout, vector<vector<double> >* segments) {
+  vector<const geometry::BoundaryLine*> lines;
+  layout.intersectionHandler.GetBoundaryLines(&lines);
+  segments->clear();
+  for (unsigned i = 0; i < lines.size(); ++i) {
+    const geometry::Segment& segment =
+        static_cast<const geometry::StraightBoundaryLine*>(lines[i])->
+            GetSegment();
+    vector<double> coordinates;
+    coordinates.push_back(segment.A().x);
+    coordinates.push_back(segment.A().y);
+    coordinates.push_back(segment.B().x);
+    coordinates.push_back(segment.B().y);
+    segments->push_back(coordinates);
+  }
+  sort(segments->begin(), segments->end());
+}
+
+int main() {
+  TestIntersectionHandler::RunTests();
+  return 0;
+}
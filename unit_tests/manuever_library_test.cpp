@@ -0,0 +1,245 @@
+#include "simulation/manuever_library.h"
+
+#include "geometry/geometry_utils.h"
+#include "geometry/point.h"
+#include "geometry/vector.h"
+#include "simulation/car_description.h"
+#include "simulation/car_manuever.h"
+#include "simulation/car_movement_handler.h"
+#include "simulation/car_position.h"
+#include "simulation/car_positions_graph.h"
+#include "unit_tests/test_base.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+using namespace std;
+
+static const double LATTICE_STEP = 1.0;
+static const int NUMBER_OF_HEADINGS = 20;
+static const int NUMBER_OF_LOOKUPS = 20000;
+static const double TOLERANCE = 1e-6;
+static const char* LIBRARY_FILE = "manuever_library_test.bin";
+
+// Checks that the library finds the same manuevers as solving them in an
+// empty world and that a saved library is loaded as it was built.
+class TestManueverLibrary {
+ public:
+  static void RunTests();
+  static void TestLookupMatchesSolver();
+  static void TestSaveLoad();
+  static void TestLoadRejectsOtherFiles();
+
+ private:
+  static simulation::CarDescription GetCarDescription();
+  static double Random(double min, double max);
+  // Returns a random pair of positions on the lattice along "axis" through
+  // "origin", with an offset within the reach of the library.
+  static void GetLatticePositions(const geometry::Point& origin,
+                                  const geometry::Vector& axis,
+                                  simulation::CarPosition* from,
+                                  simulation::CarPosition* to);
+  static void CheckSameManuevers(const simulation::CarManuever& expected,
+                                 const simulation::CarManuever& manuever);
+  // Returns the message of the error thrown when loading "contents" into
+  // "library".
+  static string GetLoadError(const string& contents,
+                             simulation::ManueverLibrary* library);
+
+ private:
+  static simulation::ManueverLibrary* library_;
+};
+
+simulation::ManueverLibrary* TestManueverLibrary::library_ = NULL;
+
+// static
+void TestManueverLibrary::RunTests() {
+  simulation::ManueverLibrary library(GetCarDescription(), LATTICE_STEP,
+                                      NUMBER_OF_HEADINGS);
+  library.Build();
+  ASSERT(library.GetNumberOfManuevers() > 0);
+  library_ = &library;
+  TestLookupMatchesSolver();
+  TestSaveLoad();
+  TestLoadRejectsOtherFiles();
+  library_ = NULL;
+  remove(LIBRARY_FILE);
+}
+
+// static
+void TestManueverLibrary::TestLookupMatchesSolver() {
+  simulation::CarMovementHandler movement_handler(NULL, GetCarDescription());
+  simulation::CarMovementContext context;
+  int found = 0;
+  srand(1);
+  for (int i = 0; i < NUMBER_OF_LOOKUPS; ++i) {
+    // The lattice of an object may run in any direction.
+    double angle = Random(0.0, 2.0 * geometry::GeometryUtils::PI);
+    geometry::Vector axis(cos(angle), sin(angle));
+    geometry::Point origin(Random(-50.0, 50.0), Random(-50.0, 50.0));
+    simulation::CarPosition from, to;
+    GetLatticePositions(origin, axis, &from, &to);
+
+    simulation::CarManuever expected, manuever;
+    bool solved = movement_handler.SingleManueverBetweenStates(
+        from, to, expected, &context);
+    simulation::ManueverLibrary::LookupResult result =
+        library_->Lookup(from, to, axis, &manuever);
+    ASSERT(result != simulation::ManueverLibrary::NOT_ON_LATTICE);
+    bool looked_up = result == simulation::ManueverLibrary::MANUEVER_FOUND;
+    ASSERT_EQUALS(solved, looked_up);
+    if (solved && looked_up) {
+      CheckSameManuevers(expected, manuever);
+      ++found;
+    }
+  }
+  ASSERT(found > 0);
+  ASSERT(found < NUMBER_OF_LOOKUPS);
+
+  // Positions off the lattice are left to the solver.
+  simulation::CarPosition from, to;
+  GetLatticePositions(geometry::Point(0.0, 0.0), geometry::Vector(1.0, 0.0),
+                      &from, &to);
+  to.SetCenter(geometry::Point(to.GetCenter().x + 0.5 * LATTICE_STEP,
+                               to.GetCenter().y));
+  simulation::CarManuever manuever;
+  ASSERT_EQUALS(simulation::ManueverLibrary::NOT_ON_LATTICE,
+                library_->Lookup(from, to, geometry::Vector(1.0, 0.0),
+                                 &manuever));
+}
+
+// static
+void TestManueverLibrary::TestSaveLoad() {
+  library_->Save(LIBRARY_FILE);
+  simulation::ManueverLibrary loaded(GetCarDescription(), LATTICE_STEP,
+                                     NUMBER_OF_HEADINGS);
+  loaded.Load(LIBRARY_FILE);
+  ASSERT_EQUALS(library_->GetNumberOfManuevers(),
+                loaded.GetNumberOfManuevers());
+
+  srand(2);
+  for (int i = 0; i < NUMBER_OF_LOOKUPS; ++i) {
+    geometry::Vector axis(1.0, 0.0);
+    simulation::CarPosition from, to;
+    GetLatticePositions(geometry::Point(0.0, 0.0), axis, &from, &to);
+    simulation::CarManuever built_manuever, loaded_manuever;
+    simulation::ManueverLibrary::LookupResult built_result =
+        library_->Lookup(from, to, axis, &built_manuever);
+    simulation::ManueverLibrary::LookupResult loaded_result =
+        loaded.Lookup(from, to, axis, &loaded_manuever);
+    ASSERT_EQUALS(built_result, loaded_result);
+    if (built_result == simulation::ManueverLibrary::MANUEVER_FOUND &&
+        loaded_result == simulation::ManueverLibrary::MANUEVER_FOUND) {
+      // The numbers are saved as they are.
+      ASSERT_EQUALS(built_manuever.GetInitialStraightSectionDistance(),
+                    loaded_manuever.GetInitialStraightSectionDistance());
+      ASSERT_EQUALS(built_manuever.GetFinalStraightSectionDistance(),
+                    loaded_manuever.GetFinalStraightSectionDistance());
+      ASSERT_EQUALS(built_manuever.GetTurnAngle(),
+                    loaded_manuever.GetTurnAngle());
+    }
+  }
+}
+
+// static
+void TestManueverLibrary::TestLoadRejectsOtherFiles() {
+  library_->Save(LIBRARY_FILE);
+  string contents;
+  {
+    ifstream in(LIBRARY_FILE, ios::in | ios::binary);
+    contents.assign(istreambuf_iterator<char>(in),
+                    istreambuf_iterator<char>());
+  }
+
+  simulation::ManueverLibrary other_car(
+      simulation::CarDescription(1.8, 4.52, GetCarDescription().
+                                     GetMaxSteeringAngle()),
+      LATTICE_STEP, NUMBER_OF_HEADINGS);
+  ASSERT(GetLoadError(contents, &other_car).find("another car") !=
+         string::npos);
+
+  // Cut in the header and in the arrays.
+  simulation::ManueverLibrary library(GetCarDescription(), LATTICE_STEP,
+                                      NUMBER_OF_HEADINGS);
+  ASSERT(GetLoadError(contents.substr(0, 40), &library).find("truncated") !=
+         string::npos);
+  ASSERT(GetLoadError(contents.substr(0, contents.size() / 2), &library).
+         find("truncated") != string::npos);
+  ASSERT(GetLoadError(contents + string(8, '\0'), &library).find(
+      "corrupted") != string::npos);
+  ASSERT_EQUALS(string(), GetLoadError(contents, &library));
+}
+
+// static
+simulation::CarDescription TestManueverLibrary::GetCarDescription() {
+  return simulation::CarDescription(
+      1.71, 4.52, geometry::GeometryUtils::DegreesToRadians(33.75));
+}
+
+// static
+double TestManueverLibrary::Random(double min, double max) {
+  return min + (max - min) * rand() / RAND_MAX;
+}
+
+// static
+void TestManueverLibrary::GetLatticePositions(
+    const geometry::Point& origin, const geometry::Vector& axis,
+    simulation::CarPosition* from, simulation::CarPosition* to) {
+  int max_offset = static_cast<int>(
+      simulation::CarPositionsGraph::GetDefaultManueverReach(
+          GetCarDescription()) / LATTICE_STEP);
+  double heading_step = 2.0 * geometry::GeometryUtils::PI / NUMBER_OF_HEADINGS;
+  int offset_x = rand() % (2 * max_offset + 1) - max_offset;
+  int offset_y = rand() % (2 * max_offset + 1) - max_offset;
+  geometry::Vector across = axis.GetOrthogonal();
+  from->SetCenter(origin);
+  from->SetDirection(axis.Rotate(
+      (rand() % NUMBER_OF_HEADINGS) * heading_step));
+  to->SetCenter(origin + axis * (offset_x * LATTICE_STEP) +
+                across * (offset_y * LATTICE_STEP));
+  to->SetDirection(axis.Rotate(
+      (rand() % NUMBER_OF_HEADINGS) * heading_step));
+}
+
+// static
+void TestManueverLibrary::CheckSameManuevers(
+    const simulation::CarManuever& expected,
+    const simulation::CarManuever& manuever) {
+  ASSERT(fabs(expected.GetInitialStraightSectionDistance() -
+              manuever.GetInitialStraightSectionDistance()) < TOLERANCE);
+  ASSERT(fabs(expected.GetFinalStraightSectionDistance() -
+              manuever.GetFinalStraightSectionDistance()) < TOLERANCE);
+  ASSERT(fabs(expected.GetTurnAngle() - manuever.GetTurnAngle()) <
+         TOLERANCE);
+  // Both should lead to the same position.
+  simulation::CarPosition expected_end =
+      expected.GetPosition(expected.GetTotalDistance());
+  simulation::CarPosition end = manuever.GetPosition(
+      manuever.GetTotalDistance());
+  ASSERT(expected_end.GetCenter().GetDistance(end.GetCenter()) < TOLERANCE);
+}
+
+// static
+string TestManueverLibrary::GetLoadError(
+    const string& contents, simulation::ManueverLibrary* library) {
+  {
+    ofstream out(LIBRARY_FILE, ios::out | ios::binary);
+    out << contents;
+  }
+  try {
+    library->Load(LIBRARY_FILE);
+  } catch (const runtime_error& e) {
+    return e.what();
+  }
+  return string();
+}
+
+int main() {
+  TestManueverLibrary::RunTests();
+  return 0;
+}
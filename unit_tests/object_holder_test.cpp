@@ -0,0 +1,211 @@
+#include "utils/object_holder.h"
+
+#include "geometry/directed_rectangle_object.h"
+#include "geometry/point.h"
+#include "geometry/rectangle_object.h"
+#include "unit_tests/test_base.h"
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+static const char* LAYOUT_FILES[] = {
+  "../resources/parking_serialized.txt",
+  "../resources/parking_serialized_straight.txt",
+  "../resources/parking_serialized_turn.txt",
+  "../resources/parking_serialized_two_turns.txt"
+};
+static const char* MALFORMED_LAYOUT_FILE = "object_holder_test.txt";
+static const char* BINARY_LAYOUT_FILE = "object_holder_test.bin";
+
+// Checks the layout parser against parsing every line of the layout with
+// RectangleObject::Parse, as the layouts were read before, and that the
+// binary layouts hold the same objects as the text ones.
+class TestObjectHolder {
+ public:
+  static void RunTests();
+  static void TestParseFromFile();
+  static void TestParseErrors();
+  static void TestBinaryRoundTrip();
+  static void TestTruncatedBinaryLayout();
+
+ private:
+  // Reads the sections of "file_path" line by line into "containers".
+  static void ParseLineByLine(const string& file_path,
+                              vector<geometry::RectangleObject*> containers[]);
+  static void CheckSameObjects(
+      const utils::RectangleObjectContainer& objects,
+      const vector<geometry::RectangleObject*>& expected);
+  // Returns the message of the error thrown when parsing "contents".
+  static string GetParseError(const string& contents);
+};
+
+// static
+void TestObjectHolder::RunTests() {
+  TestParseFromFile();
+  TestParseErrors();
+  TestBinaryRoundTrip();
+  TestTruncatedBinaryLayout();
+}
+
+// static
+void TestObjectHolder::TestParseFromFile() {
+  for (unsigned i = 0; i < sizeof(LAYOUT_FILES) / sizeof(LAYOUT_FILES[0]);
+       ++i) {
+    utils::ObjectHolder object_holder;
+    object_holder.ParseFromFile(LAYOUT_FILES[i]);
+    vector<geometry::RectangleObject*> expected[3];
+    ParseLineByLine(LAYOUT_FILES[i], expected);
+    ASSERT(!expected[0].empty());
+    CheckSameObjects(object_holder.GetRoadSegments(), expected[0]);
+    CheckSameObjects(object_holder.GetParkingLots(), expected[1]);
+    CheckSameObjects(object_holder.GetObstacles(), expected[2]);
+    for (int j = 0; j < 3; ++j) {
+      for (unsigned k = 0; k < expected[j].size(); ++k) {
+        delete expected[j][k];
+      }
+    }
+  }
+}
+
+// static
+void TestObjectHolder::TestParseErrors() {
+  // Blank lines, spaces and carriage returns are accepted.
+  ASSERT_EQUALS(string(), GetParseError(
+      "1\r\n\r\n  (0, 0)  (1, 2.5) 3 \r\n0\n1\nDirectedRectangleObject 1 "
+      "(0,0) (1,1) 2\n"));
+  ASSERT(GetParseError("1\n(0, 0) (1, x) 3\n0\n0\n").find(
+      ":2:12: expected a number") != string::npos);
+  ASSERT(GetParseError("1\n(0, 0) (1, 1) 3\n").find(
+      ":3:1: unexpected end of file") != string::npos);
+  ASSERT(GetParseError("1\nDirectedRectangleObject 2 (0, 0) (1, 1) 3\n0\n0\n")
+      .find(":2:25: expected 0 or 1") != string::npos);
+  ASSERT(GetParseError("1\n(0, 0) (1, 1) 3 4\n0\n0\n").find(
+      ":2:17: expected the end of the line") != string::npos);
+  remove(MALFORMED_LAYOUT_FILE);
+}
+
+// static
+void TestObjectHolder::TestBinaryRoundTrip() {
+  for (unsigned i = 0; i < sizeof(LAYOUT_FILES) / sizeof(LAYOUT_FILES[0]);
+       ++i) {
+    utils::ObjectHolder text_layout;
+    text_layout.ParseFromFile(LAYOUT_FILES[i]);
+    text_layout.DumpToBinaryFile(BINARY_LAYOUT_FILE);
+    utils::ObjectHolder binary_layout;
+    binary_layout.ParseFromFile(BINARY_LAYOUT_FILE);
+    CheckSameObjects(binary_layout.GetRoadSegments(),
+                     text_layout.GetRoadSegments());
+    CheckSameObjects(binary_layout.GetParkingLots(),
+                     text_layout.GetParkingLots());
+    CheckSameObjects(binary_layout.GetObstacles(),
+                     text_layout.GetObstacles());
+  }
+  remove(BINARY_LAYOUT_FILE);
+}
+
+// static
+void TestObjectHolder::TestTruncatedBinaryLayout() {
+  utils::ObjectHolder layout;
+  layout.ParseFromFile(LAYOUT_FILES[0]);
+  layout.DumpToBinaryFile(BINARY_LAYOUT_FILE);
+  string contents;
+  {
+    ifstream in(BINARY_LAYOUT_FILE, ios::in | ios::binary);
+    contents.assign(istreambuf_iterator<char>(in),
+                    istreambuf_iterator<char>());
+  }
+  // Cut in the header, in the section table and in the records.
+  const size_t sizes[] = { 12, 40, contents.size() - 1 };
+  for (unsigned i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i) {
+    {
+      ofstream out(BINARY_LAYOUT_FILE, ios::out | ios::binary);
+      out.write(contents.data(), sizes[i]);
+    }
+    utils::ObjectHolder truncated_layout;
+    bool rejected = false;
+    try {
+      truncated_layout.ParseFromFile(BINARY_LAYOUT_FILE);
+    } catch (const runtime_error& e) {
+      rejected = string(e.what()).find("truncated") != string::npos;
+    }
+    ASSERT(rejected);
+  }
+  remove(BINARY_LAYOUT_FILE);
+}
+
+// static
+void TestObjectHolder::ParseLineByLine(
+    const string& file_path, vector<geometry::RectangleObject*> containers[]) {
+  ifstream in(file_path.c_str());
+  for (int section = 0; section < 3; ++section) {
+    unsigned count = 0;
+    string line;
+    in >> count;
+    getline(in, line);
+    for (unsigned index = 0; index < count; ++index) {
+      getline(in, line);
+      geometry::RectangleObject* object;
+      if (geometry::DirectedRectangleObject::
+              IsSerializedDirectedRectangleObject(line)) {
+        object = new geometry::DirectedRectangleObject();
+      } else {
+        object = new geometry::RectangleObject();
+      }
+      object->Parse(line);
+      containers[section].push_back(object);
+    }
+  }
+}
+
+// static
+void TestObjectHolder::CheckSameObjects(
+    const utils::RectangleObjectContainer& objects,
+    const vector<geometry::RectangleObject*>& expected) {
+  ASSERT_EQUALS(expected.size(), objects.size());
+  if (expected.size() != objects.size()) {
+    return;
+  }
+  for (unsigned index = 0; index < objects.size(); ++index) {
+    const geometry::RectangleObject* object = objects[index];
+    // The numbers should be converted exactly as before.
+    ASSERT_EQUALS(expected[index]->GetFrom().x, object->GetFrom().x);
+    ASSERT_EQUALS(expected[index]->GetFrom().y, object->GetFrom().y);
+    ASSERT_EQUALS(expected[index]->GetTo().x, object->GetTo().x);
+    ASSERT_EQUALS(expected[index]->GetTo().y, object->GetTo().y);
+    ASSERT_EQUALS(expected[index]->GetWidth(), object->GetWidth());
+    ASSERT_EQUALS(expected[index]->IsDirected(), object->IsDirected());
+    if (object->IsDirected() && expected[index]->IsDirected()) {
+      ASSERT_EQUALS(
+          static_cast<const geometry::DirectedRectangleObject*>(
+              expected[index])->IsOneWay(),
+          static_cast<const geometry::DirectedRectangleObject*>(
+              object)->IsOneWay());
+    }
+  }
+}
+
+// static
+string TestObjectHolder::GetParseError(const string& contents) {
+  {
+    ofstream out(MALFORMED_LAYOUT_FILE, ios::out | ios::binary);
+    out << contents;
+  }
+  utils::ObjectHolder object_holder;
+  try {
+    object_holder.ParseFromFile(MALFORMED_LAYOUT_FILE);
+  } catch (const runtime_error& e) {
+    return e.what();
+  }
+  return string();
+}
+
+int main() {
+  TestObjectHolder::RunTests();
+  return 0;
+}
@@ -0,0 +1,225 @@
+#include "geometry/segment_arrays.h"
+
+#include "geometry/boundary_line.h"
+#include "geometry/geometry_utils.h"
+#include "geometry/point.h"
+#include "geometry/polygon.h"
+#include "geometry/segment.h"
+#include "geometry/straight_boundary_line.h"
+#include "geometry/vector.h"
+#include "simulation/car_description.h"
+#include "simulation/car_position.h"
+#include "unit_tests/test_base.h"
+#include "utils/boundary_line_holder.h"
+#include "utils/intersection_handler.h"
+#include "utils/object_holder.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace std;
+
+static const int NUMBER_OF_SEGMENTS = 203;
+static const int NUMBER_OF_RECTANGLES = 2000;
+static const int NUMBER_OF_LAYOUT_QUERIES = 20000;
+static const char* LAYOUT_FILE = "../resources/parking_serialized.txt";
+
+// Checks every compiled filter of FindFirstIntersectedSegment and the grid
+// using them against the exact intersection of the polygon and the segments.
+class TestSegmentArrays {
+ public:
+  static void RunTests();
+  static void TestFindFirstIntersectedSegment();
+  static void TestTouchingSegments();
+  static void TestNonRectangle();
+  static void TestGridIntersectedSegment();
+
+ private:
+  static double Random(double min, double max);
+  static geometry::Polygon GetRectangle(const geometry::Point& center,
+                                        double angle, double half_length,
+                                        double half_width);
+  // Checks that "filter" finds, starting from every segment, the same
+  // first intersected segment as the exact test.
+  static void CheckFilter(const geometry::Polygon& polygon,
+                          const vector<geometry::Segment>& segments,
+                          const geometry::SegmentArrays& arrays,
+                          geometry::SegmentFilter filter);
+  static void CheckAllFilters(const geometry::Polygon& polygon,
+                              const vector<geometry::Segment>& segments);
+};
+
+// static
+void TestSegmentArrays::RunTests() {
+  ASSERT(geometry::IsSegmentFilterAvailable(geometry::SCALAR_SEGMENT_FILTER));
+  TestFindFirstIntersectedSegment();
+  TestTouchingSegments();
+  TestNonRectangle();
+  TestGridIntersectedSegment();
+}
+
+// static
+void TestSegmentArrays::TestFindFirstIntersectedSegment() {
+  srand(1);
+  // An odd number of segments, so that the groups of every filter leave
+  // some of them to the scalar loop.
+  vector<geometry::Segment> segments;
+  for (int i = 0; i < NUMBER_OF_SEGMENTS; ++i) {
+    geometry::Point a(Random(-20.0, 20.0), Random(-20.0, 20.0));
+    double angle = Random(0.0, 2.0 * geometry::GeometryUtils::PI);
+    double length = Random(0.1, 8.0);
+    segments.push_back(geometry::Segment(
+        a, geometry::Point(a.x + length * cos(angle),
+                           a.y + length * sin(angle))));
+  }
+  for (int i = 0; i < NUMBER_OF_RECTANGLES; ++i) {
+    geometry::Polygon rectangle = GetRectangle(
+        geometry::Point(Random(-20.0, 20.0), Random(-20.0, 20.0)),
+        Random(0.0, 2.0 * geometry::GeometryUtils::PI),
+        Random(0.5, 3.0), Random(0.5, 1.5));
+    CheckAllFilters(rectangle, segments);
+  }
+}
+
+// static
+void TestSegmentArrays::TestTouchingSegments() {
+  geometry::Polygon rectangle = GetRectangle(geometry::Point(1.0, 2.0), 0.3,
+                                             2.0, 1.0);
+  vector<geometry::Segment> segments;
+  for (unsigned i = 0; i < rectangle.NumberOfVertices(); ++i) {
+    const geometry::Point& from = rectangle.GetPoint(i);
+    const geometry::Point& to =
+        rectangle.GetPoint((i + 1) % rectangle.NumberOfVertices());
+    // Along the side, out of a vertex and just off the side.
+    segments.push_back(geometry::Segment(from, to));
+    segments.push_back(geometry::Segment(
+        from, geometry::Point(2.0 * from.x - to.x, 2.0 * from.y - to.y)));
+    segments.push_back(geometry::Segment(
+        geometry::Point(from.x + 1e-3, from.y + 10.0),
+        geometry::Point(to.x + 1e-3, to.y + 10.0)));
+  }
+  CheckAllFilters(rectangle, segments);
+}
+
+// static
+void TestSegmentArrays::TestNonRectangle() {
+  vector<geometry::Point> points;
+  points.push_back(geometry::Point(0.0, 0.0));
+  points.push_back(geometry::Point(4.0, 0.0));
+  points.push_back(geometry::Point(0.0, 3.0));
+  geometry::Polygon triangle(points);
+  vector<geometry::Segment> segments;
+  segments.push_back(geometry::Segment(geometry::Point(3.0, 3.0),
+                                       geometry::Point(4.0, 4.0)));
+  segments.push_back(geometry::Segment(geometry::Point(1.0, 1.0),
+                                       geometry::Point(5.0, 5.0)));
+  geometry::SegmentArrays arrays;
+  for (unsigned i = 0; i < segments.size(); ++i) {
+    arrays.Add(segments[i]);
+  }
+  ASSERT_EQUALS(1, geometry::FindFirstIntersectedSegment(
+      triangle, arrays, 0, arrays.Size()));
+}
+
+// static
+void TestSegmentArrays::TestGridIntersectedSegment() {
+  utils::ObjectHolder object_holder;
+  utils::BoundaryLinesHolder boundary_lines_holder;
+  utils::IntersectionHandler intersection_handler(
+      -250.0, 250.0, -150.0, 150.0, &boundary_lines_holder);
+  object_holder.ParseFromFile(LAYOUT_FILE);
+  intersection_handler.Init(object_holder);
+
+  vector<const geometry::BoundaryLine*> lines;
+  intersection_handler.GetBoundaryLines(&lines);
+  simulation::CarDescription description(1.71, 4.52, 0.5);
+  vector<geometry::SegmentSpan> spans;
+  srand(2);
+  for (int i = 0; i < NUMBER_OF_LAYOUT_QUERIES; ++i) {
+    double angle = Random(0.0, 2.0 * geometry::GeometryUtils::PI);
+    simulation::CarPosition position;
+    position.SetCenter(geometry::Point(Random(-60.0, 60.0),
+                                       Random(-40.0, 40.0)));
+    position.SetDirection(geometry::Vector(cos(angle), sin(angle)));
+    geometry::Polygon bounds;
+    description.GetBounds(position, bounds);
+
+    bool expected = false;
+    for (unsigned j = 0; j < lines.size() && !expected; ++j) {
+      expected = Intersect(bounds,
+          static_cast<const geometry::StraightBoundaryLine*>(lines[j])->
+              GetSegment(), NULL);
+    }
+    const geometry::Segment* intersected =
+        intersection_handler.GetIntersectedBoundarySegment(bounds, &spans);
+    bool found = intersected != NULL;
+    ASSERT_EQUALS(expected, found);
+    if (found) {
+      ASSERT(Intersect(bounds, *intersected, NULL));
+    }
+  }
+}
+
+// static
+double TestSegmentArrays::Random(double min, double max) {
+  return min + (max - min) * rand() / RAND_MAX;
+}
+
+// static
+geometry::Polygon TestSegmentArrays::GetRectangle(
+    const geometry::Point& center, double angle, double half_length,
+    double half_width) {
+  double ux = cos(angle) * half_length, uy = sin(angle) * half_length;
+  double vx = -sin(angle) * half_width, vy = cos(angle) * half_width;
+  vector<geometry::Point> points;
+  points.push_back(geometry::Point(center.x - ux - vx, center.y - uy - vy));
+  points.push_back(geometry::Point(center.x + ux - vx, center.y + uy - vy));
+  points.push_back(geometry::Point(center.x + ux + vx, center.y + uy + vy));
+  points.push_back(geometry::Point(center.x - ux + vx, center.y - uy + vy));
+  return geometry::Polygon(points);
+}
+
+// static
+void TestSegmentArrays::CheckFilter(
+    const geometry::Polygon& polygon,
+    const vector<geometry::Segment>& segments,
+    const geometry::SegmentArrays& arrays, geometry::SegmentFilter filter) {
+  int end = segments.size();
+  for (int begin = 0; begin < end; ++begin) {
+    int expected = -1;
+    for (int index = begin; index < end && expected == -1; ++index) {
+      if (Intersect(polygon, segments[index], NULL)) {
+        expected = index;
+      }
+    }
+    ASSERT_EQUALS(expected, geometry::FindFirstIntersectedSegment(
+        polygon, arrays, begin, end, filter));
+  }
+}
+
+// static
+void TestSegmentArrays::CheckAllFilters(
+    const geometry::Polygon& polygon,
+    const vector<geometry::Segment>& segments) {
+  geometry::SegmentArrays arrays;
+  for (unsigned i = 0; i < segments.size(); ++i) {
+    arrays.Add(segments[i]);
+  }
+  const geometry::SegmentFilter filters[] = {
+    geometry::SCALAR_SEGMENT_FILTER,
+    geometry::SSE2_SEGMENT_FILTER,
+    geometry::AVX2_SEGMENT_FILTER
+  };
+  for (unsigned i = 0; i < sizeof(filters) / sizeof(filters[0]); ++i) {
+    if (geometry::IsSegmentFilterAvailable(filters[i])) {
+      CheckFilter(polygon, segments, arrays, filters[i]);
+    }
+  }
+}
+
+int main() {
+  TestSegmentArrays::RunTests();
+  return 0;
+}
@@ -1,54 +1,106 @@
-#include "utils/benchmark.h"
-
-#include "utils/delay.h"
-
-#include <iomanip>
-#include <iostream>
-#include <fstream>
-#include <vector>
-#include <string>
-
-namespace utils {
-// static declarations
-std::vector<Benchmark::BenchmarkItem> Benchmark::timeTable_;
-int Benchmark::gCounter_ = 0;
-int Benchmark::currentCounter_ = 0;
-
-Benchmark::Benchmark(const std::string& function_name, int index)
-  : index_(index) {
-  startTime_ = get_time();
-  if(index_ >= static_cast<int>(timeTable_.size())) {
-    timeTable_.resize(index_ + 1);
-  }
-  if (timeTable_[index_].name.empty()) {
-    timeTable_[index_].name = function_name;
-  }
-}
-
-Benchmark::~Benchmark() {
-  double duration = get_time() - startTime_;
-  timeTable_[index_].numberOfTimes++;
-  timeTable_[index_].totalTime += duration;
-}
-
-// static
-void Benchmark::DumpBenchmarkingInfo() {
-  if (timeTable_.empty()) {
-    return;
-  }
-  std::ofstream dump_file("../../resources/dump.txt", std::ios::app);
-  std::cerr << "### Dumping benchmark info ###\n";
-  dump_file << "### Dumping benchmark info ###\n";
-  for (unsigned index = 0; index < timeTable_.size(); ++index) {
-    std::cerr << timeTable_[index].name << ": " << std::setprecision(9)
-        << timeTable_[index].totalTime << " ("
-        << timeTable_[index].numberOfTimes << ")"
-        << std::endl;
-    dump_file << timeTable_[index].name << ": " << std::setprecision(9)
-        << timeTable_[index].totalTime << " ("
-        << timeTable_[index].numberOfTimes << ")"
-        << std::endl;
-  }
-}
-
-}  // namespace utils
+#include "utils/benchmark.h"
+
+#include "utils/delay.h"
+
+#include <iomanip>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <string>
+
+namespace utils {
+// static declarations
+std::atomic<int> Benchmark::gCounter_(0);
+std::mutex Benchmark::timeTablesMutex_;
+std::vector<std::vector<Benchmark::BenchmarkItem>*> Benchmark::timeTables_;
+
+Benchmark::Benchmark(const std::string& function_name, int index)
+  : index_(index), timeTable_(GetThreadTimeTable()) {
+  startTime_ = get_wall_time();
+  if(index_ >= static_cast<int>(timeTable_->size())) {
+    timeTable_->resize(index_ + 1);
+  }
+  if ((*timeTable_)[index_].name.empty()) {
+    (*timeTable_)[index_].name = function_name;
+  }
+}
+
+Benchmark::~Benchmark() {
+  double duration = get_wall_time() - startTime_;
+  (*timeTable_)[index_].numberOfTimes++;
+  (*timeTable_)[index_].totalTime += duration;
+}
+
+// static
+int Benchmark::GetNewCounter() {
+  return gCounter_++;
+}
+
+// static
+void Benchmark::Count(const char* file, const char* function, int line,
+                      const char* label, int index) {
+  std::vector<BenchmarkItem>* time_table = GetThreadTimeTable();
+  if (index >= static_cast<int>(time_table->size())) {
+    time_table->resize(index + 1);
+  }
+  BenchmarkItem& item = (*time_table)[index];
+  if (item.name.empty()) {
+    std::ostringstream name;
+    name << file << ":" << function << "(" << line << ") [" << label << "]";
+    item.name = name.str();
+  }
+  item.numberOfTimes++;
+}
+
+// static
+std::vector<Benchmark::BenchmarkItem>* Benchmark::GetThreadTimeTable() {
+  // The tables are never freed so that DumpBenchmarkingInfo can still read
+  // the ones of threads that have already finished.
+  static thread_local std::vector<BenchmarkItem>* time_table = NULL;
+  if (time_table == NULL) {
+    time_table = new std::vector<BenchmarkItem>();
+    std::lock_guard<std::mutex> lock(timeTablesMutex_);
+    timeTables_.push_back(time_table);
+  }
+  return time_table;
+}
+
+// static
+void Benchmark::DumpBenchmarkingInfo() {
+  std::vector<BenchmarkItem> time_table;
+  {
+    std::lock_guard<std::mutex> lock(timeTablesMutex_);
+    for (unsigned table = 0; table < timeTables_.size(); ++table) {
+      const std::vector<BenchmarkItem>& items = *timeTables_[table];
+      if (items.size() > time_table.size()) {
+        time_table.resize(items.size());
+      }
+      for (unsigned index = 0; index < items.size(); ++index) {
+        time_table[index].totalTime += items[index].totalTime;
+        time_table[index].numberOfTimes += items[index].numberOfTimes;
+        if (time_table[index].name.empty()) {
+          time_table[index].name = items[index].name;
+        }
+      }
+    }
+  }
+  if (time_table.empty()) {
+    return;
+  }
+  std::ofstream dump_file("../../resources/dump.txt", std::ios::app);
+  std::cerr << "### Dumping benchmark info ###\n";
+  dump_file << "### Dumping benchmark info ###\n";
+  for (unsigned index = 0; index < time_table.size(); ++index) {
+    std::cerr << time_table[index].name << ": " << std::setprecision(9)
+        << time_table[index].totalTime << " ("
+        << time_table[index].numberOfTimes << ")"
+        << std::endl;
+    dump_file << time_table[index].name << ": " << std::setprecision(9)
+        << time_table[index].totalTime << " ("
+        << time_table[index].numberOfTimes << ")"
+        << std::endl;
+  }
+}
+
+}  // namespace utils
@@ -0,0 +1,52 @@
+#include "utils/binary_file.h"
+
+#include "utils/mapped_file.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+
+namespace utils {
+
+static const unsigned long long HASH_PRIME = 1099511628211ULL;
+
+unsigned long long HashBytes(const void* data, size_t size,
+                             unsigned long long hash) {
+  const unsigned char* bytes = static_cast<const unsigned char*>(data);
+  for (size_t index = 0; index < size; ++index) {
+    hash = (hash ^ bytes[index]) * HASH_PRIME;
+  }
+  return hash;
+}
+
+unsigned long long HashDouble(double value, unsigned long long hash) {
+  return HashBytes(&value, sizeof(value), hash);
+}
+
+size_t GetBinaryFilePadding(size_t size) {
+  return (BINARY_FILE_ALIGNMENT - size % BINARY_FILE_ALIGNMENT) %
+      BINARY_FILE_ALIGNMENT;
+}
+
+BinaryFileReader::BinaryFileReader(const MappedFile& file,
+                                   const std::string& truncated_message)
+  : data_(file.GetData()),
+    size_(file.GetSize()),
+    offset_(0),
+    truncatedMessage_(truncated_message) {}
+
+bool BinaryFileReader::AtEnd() const {
+  return offset_ == size_;
+}
+
+void BinaryFileReader::Skip(bool invalid, size_t size) {
+  if (invalid || size > size_ - offset_) {
+    throw std::runtime_error(truncatedMessage_);
+  }
+  offset_ += size;
+  // The padding of the last array may be missing.
+  offset_ += std::min(GetBinaryFilePadding(size), size_ - offset_);
+}
+
+}  // namespace utils
@@ -1,14 +1,20 @@
-#include "utils/delay.h"
-
-#include <iostream>
-
-#include <ctime>
-
-double get_time() {
-  return static_cast<double>(clock())/CLOCKS_PER_SEC;
-};
-
-void delay(double seconds) {
-  double start_time = get_time();
-  while (get_time() - start_time < seconds);
-}
+#include "utils/delay.h"
+
+#include <iostream>
+
+#include <chrono>
+#include <ctime>
+
+double get_time() {
+  return static_cast<double>(clock())/CLOCKS_PER_SEC;
+};
+
+double get_wall_time() {
+  return std::chrono::duration<double>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void delay(double seconds) {
+  double start_time = get_time();
+  while (get_time() - start_time < seconds);
+}
@@ -0,0 +1,102 @@
+#include "utils/mapped_file.h"
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace utils {
+
+#ifdef _WIN32
+
+MappedFile::MappedFile(const std::string& path)
+    : data_(NULL), size_(0), file_(INVALID_HANDLE_VALUE), mapping_(NULL) {
+  file_ = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL,
+                      OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (file_ == INVALID_HANDLE_VALUE) {
+    throw std::runtime_error("Could not open " + path);
+  }
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(file_, &size)) {
+    CloseHandle(file_);
+    throw std::runtime_error("Could not get the size of " + path);
+  }
+  size_ = static_cast<size_t>(size.QuadPart);
+  // Empty files can not be mapped.
+  if (size_ == 0) {
+    return;
+  }
+  mapping_ = CreateFileMappingA(file_, NULL, PAGE_READONLY, 0, 0, NULL);
+  if (mapping_ != NULL) {
+    data_ = static_cast<const char*>(
+        MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+  }
+  if (data_ == NULL) {
+    if (mapping_ != NULL) {
+      CloseHandle(mapping_);
+    }
+    CloseHandle(file_);
+    throw std::runtime_error("Could not map " + path);
+  }
+}
+
+MappedFile::~MappedFile() {
+  if (data_ != NULL) {
+    UnmapViewOfFile(data_);
+    CloseHandle(mapping_);
+  }
+  CloseHandle(file_);
+}
+
+#else
+
+MappedFile::MappedFile(const std::string& path)
+    : data_(NULL), size_(0), file_(-1) {
+  file_ = open(path.c_str(), O_RDONLY);
+  if (file_ == -1) {
+    throw std::runtime_error("Could not open " + path);
+  }
+  struct stat file_stat;
+  if (fstat(file_, &file_stat) != 0) {
+    close(file_);
+    throw std::runtime_error("Could not get the size of " + path);
+  }
+  size_ = static_cast<size_t>(file_stat.st_size);
+  // Empty files can not be mapped.
+  if (size_ == 0) {
+    return;
+  }
+  void* data = mmap(NULL, size_, PROT_READ, MAP_PRIVATE, file_, 0);
+  if (data == MAP_FAILED) {
+    close(file_);
+    throw std::runtime_error("Could not map " + path);
+  }
+  data_ = static_cast<const char*>(data);
+}
+
+MappedFile::~MappedFile() {
+  if (data_ != NULL) {
+    munmap(const_cast<char*>(data_), size_);
+  }
+  close(file_);
+}
+
+#endif
+
+const char* MappedFile::GetData() const {
+  return data_;
+}
+
+size_t MappedFile::GetSize() const {
+  return size_;
+}
+
+}  // namespace utils
@@ -1,83 +1,412 @@
-#include "utils/object_holder.h"
-
-#include "geometry/directed_rectangle_object.h"
-#include "geometry/rectangle_object.h"
-
-#include <fstream>
-#include <stdexcept>
-#include <string>
-
-namespace utils {
-
-geometry::RectangleObject* RectangleObjectFactory(
-    const std::string& serialized) {
-  geometry::RectangleObject* res;
-  if (geometry::DirectedRectangleObject::IsSerializedDirectedRectangleObject(
-      serialized)) {
-    res = new geometry::DirectedRectangleObject();
-  } else {
-    res = new geometry::RectangleObject();
-  }
-  res->Parse(serialized);
-  return res;
-}
-
-void ObjectHolder::DumpToFile(const std::string& file_path) const {
-  std::ofstream out(file_path.c_str());
-  if (!out) {
-    throw std::runtime_error("Could not open the file to serialize into.");
-    return;
-  }
-
-  out << roadSegments_.size() << std::endl;
-  for (unsigned index = 0; index < roadSegments_.size(); ++index) {
-    out << roadSegments_[index]->Serialize() << std::endl;
-  }
-
-  out << parkingLots_.size() << std::endl;
-  for (unsigned index = 0; index < parkingLots_.size(); ++index) {
-    out << parkingLots_[index]->Serialize() << std::endl;
-  }
-
-  out << obstacles_.size() << std::endl;
-  for (unsigned index = 0; index < obstacles_.size(); ++index) {
-    out << obstacles_[index]->Serialize() << std::endl;
-  }
-}
-
-void ObjectHolder::ParseFromFile(const std::string& file_path) {
-  std::ifstream in(file_path.c_str());
-  if (!in) {
-    throw std::runtime_error("Could not open file to parse.");
-    return;
-  }
-
-  DeleteObjects();
-  std::string serialized;
-
-  unsigned road_segments_size;
-  in >>  road_segments_size;
-  getline(in, serialized);
-  for (unsigned index = 0; index < road_segments_size; ++index) {
-    getline(in, serialized);
-    roadSegments_.push_back(RectangleObjectFactory(serialized));
-  }
-
-  unsigned parking_lots_size;
-  in >>  parking_lots_size;
-  getline(in, serialized);
-  for (unsigned index = 0; index < parking_lots_size; ++index) {
-    getline(in, serialized);
-    parkingLots_.push_back(RectangleObjectFactory(serialized));
-  }
-
-  unsigned obstacles_size;
-  in >>  obstacles_size;
-  getline(in, serialized);
-  for (unsigned index = 0; index < obstacles_size; ++index) {
-    getline(in, serialized);
-    obstacles_.push_back(RectangleObjectFactory(serialized));
-  }
-}
-
-}  // namespace utils
+#include "utils/object_holder.h"
+
+#include "geometry/directed_rectangle_object.h"
+#include "geometry/point.h"
+#include "geometry/rectangle_object.h"
+#include "utils/mapped_file.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace utils {
+
+// The longest number accepted by the parser.
+static const int MAX_NUMBER_LENGTH = 63;
+static const char DIRECTED_RECTANGLE_OBJECT_STAMP[] = "DirectedRectangleObject";
+
+// The binary format. All the numbers are little-endian.
+//   header: magic (8 bytes), version (uint32), number of sections (uint32)
+//   section table, for every section: type (uint32), number of records
+//       (uint32), offset of the first record from the start of the file
+//       (uint64)
+//   records of 48 bytes: from x, from y, to x, to y, width (doubles),
+//       flags (uint32), padding (uint32)
+// Directed objects are marked by a flag instead of having sections of their
+// own, so that the objects keep their order. Sections of unknown types are
+// skipped.
+static const char BINARY_LAYOUT_MAGIC[8] = {
+    'C', 'S', 'L', 'A', 'Y', 'O', 'U', 'T'};
+static const unsigned BINARY_LAYOUT_VERSION = 1;
+static const int BINARY_HEADER_SIZE = 16;
+static const int BINARY_SECTION_ENTRY_SIZE = 16;
+static const int BINARY_RECORD_SIZE = 48;
+
+enum BinarySectionType {
+  ROAD_SEGMENTS_SECTION = 1,
+  PARKING_LOTS_SECTION = 2,
+  OBSTACLES_SECTION = 3
+};
+
+static const unsigned DIRECTED_FLAG = 1;
+static const unsigned ONE_WAY_FLAG = 2;
+
+static void AppendLittleEndian(unsigned long long value, int size,
+                               std::vector<char>* buffer) {
+  for (int index = 0; index < size; ++index) {
+    buffer->push_back(static_cast<char>((value >> (8 * index)) & 0xff));
+  }
+}
+
+static void AppendDouble(double value, std::vector<char>* buffer) {
+  unsigned long long bits;
+  memcpy(&bits, &value, sizeof(bits));
+  AppendLittleEndian(bits, 8, buffer);
+}
+
+static unsigned long long ReadLittleEndian(const char* data, int size) {
+  unsigned long long value = 0;
+  for (int index = size - 1; index >= 0; --index) {
+    value = (value << 8) | static_cast<unsigned char>(data[index]);
+  }
+  return value;
+}
+
+static double ReadDouble(const char* data) {
+  unsigned long long bits = ReadLittleEndian(data, 8);
+  double value;
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+static void AppendRecords(const RectangleObjectContainer& objects,
+                          std::vector<char>* buffer) {
+  for (unsigned index = 0; index < objects.size(); ++index) {
+    const geometry::RectangleObject* object = objects[index];
+    unsigned flags = 0;
+    if (object->IsDirected()) {
+      flags |= DIRECTED_FLAG;
+      if (static_cast<const geometry::DirectedRectangleObject*>(
+              object)->IsOneWay()) {
+        flags |= ONE_WAY_FLAG;
+      }
+    }
+    AppendDouble(object->GetFrom().x, buffer);
+    AppendDouble(object->GetFrom().y, buffer);
+    AppendDouble(object->GetTo().x, buffer);
+    AppendDouble(object->GetTo().y, buffer);
+    AppendDouble(object->GetWidth(), buffer);
+    AppendLittleEndian(flags, 4, buffer);
+    AppendLittleEndian(0, 4, buffer);
+  }
+}
+
+static bool IsBinaryLayout(const char* data, size_t size) {
+  return size >= sizeof(BINARY_LAYOUT_MAGIC) &&
+      std::equal(BINARY_LAYOUT_MAGIC,
+                 BINARY_LAYOUT_MAGIC + sizeof(BINARY_LAYOUT_MAGIC), data);
+}
+
+// Parses the records of a file in the binary format to the containers of the
+// sections, indexed by the section types.
+static void ParseBinaryLayout(const std::string& file_path, const char* data,
+                              size_t size,
+                              RectangleObjectContainer* containers[]) {
+  if (size < static_cast<size_t>(BINARY_HEADER_SIZE)) {
+    throw std::runtime_error(file_path + ": the header is truncated");
+  }
+  if (ReadLittleEndian(data + 8, 4) != BINARY_LAYOUT_VERSION) {
+    throw std::runtime_error(file_path + ": unsupported version");
+  }
+  unsigned long long number_of_sections = ReadLittleEndian(data + 12, 4);
+  if (number_of_sections >
+      (size - BINARY_HEADER_SIZE) / BINARY_SECTION_ENTRY_SIZE) {
+    throw std::runtime_error(file_path + ": the section table is truncated");
+  }
+
+  for (unsigned section = 0; section < number_of_sections; ++section) {
+    const char* entry =
+        data + BINARY_HEADER_SIZE + section * BINARY_SECTION_ENTRY_SIZE;
+    unsigned type = static_cast<unsigned>(ReadLittleEndian(entry, 4));
+    unsigned long long count = ReadLittleEndian(entry + 4, 4);
+    unsigned long long offset = ReadLittleEndian(entry + 8, 8);
+    if (offset > size || count > (size - offset) / BINARY_RECORD_SIZE) {
+      throw std::runtime_error(file_path + ": a section is truncated");
+    }
+    if (type < ROAD_SEGMENTS_SECTION || type > OBSTACLES_SECTION) {
+      continue;
+    }
+
+    RectangleObjectContainer* container = containers[type];
+    container->reserve(container->size() + count);
+    for (unsigned index = 0; index < count; ++index) {
+      const char* record = data + offset + index * BINARY_RECORD_SIZE;
+      unsigned flags = static_cast<unsigned>(ReadLittleEndian(record + 40, 4));
+      geometry::RectangleObject* object;
+      if (flags & DIRECTED_FLAG) {
+        geometry::DirectedRectangleObject* directed_object =
+            new geometry::DirectedRectangleObject();
+        directed_object->SetIsOneWay((flags & ONE_WAY_FLAG) != 0);
+        object = directed_object;
+      } else {
+        object = new geometry::RectangleObject();
+      }
+      object->SetFrom(geometry::Point(ReadDouble(record),
+                                      ReadDouble(record + 8)));
+      object->SetTo(geometry::Point(ReadDouble(record + 16),
+                                    ReadDouble(record + 24)));
+      object->SetWidth(ReadDouble(record + 32));
+      container->push_back(object);
+    }
+  }
+}
+
+static bool IsSpace(char c) {
+  return isspace(static_cast<unsigned char>(c)) != 0;
+}
+
+static bool IsDigit(char c) {
+  return isdigit(static_cast<unsigned char>(c)) != 0;
+}
+
+// Parses the text format written by ObjectHolder::DumpToFile in a single pass
+// over a buffer holding the whole file. The objects are created straight
+// from the numbers read, without copying their lines. Every error is
+// reported with the line and the column where it was found.
+class LayoutParser {
+ public:
+  LayoutParser(const std::string& file_path, const char* begin,
+               const char* end)
+    : filePath_(file_path), current_(begin), end_(end), lineBegin_(begin),
+      line_(1) {}
+
+  // Parses the number of objects in the following section.
+  unsigned ParseCount() {
+    SkipBlankLines();
+    const char* begin = current_;
+    while (current_ != end_ && IsDigit(*current_)) {
+      ++current_;
+    }
+    if (current_ == begin || current_ - begin > MAX_NUMBER_LENGTH) {
+      Fail(begin, "expected the number of objects");
+    }
+    char buffer[MAX_NUMBER_LENGTH + 1];
+    std::copy(begin, current_, buffer);
+    buffer[current_ - begin] = 0;
+    unsigned long count = strtoul(buffer, NULL, 10);
+    ExpectEndOfLine();
+    return static_cast<unsigned>(count);
+  }
+
+  // Parses one object per line, either
+  //   (<x>, <y>) (<x>, <y>) <width>
+  // or a directed object
+  //   DirectedRectangleObject <0 or 1 for one way> (<x>, <y>) ...
+  geometry::RectangleObject* ParseObject() {
+    SkipBlankLines();
+    bool directed = false;
+    bool one_way = false;
+    if (*current_ == DIRECTED_RECTANGLE_OBJECT_STAMP[0]) {
+      size_t stamp_size = strlen(DIRECTED_RECTANGLE_OBJECT_STAMP);
+      if (static_cast<size_t>(end_ - current_) < stamp_size ||
+          !std::equal(current_, current_ + stamp_size,
+                      DIRECTED_RECTANGLE_OBJECT_STAMP)) {
+        Fail(current_, "expected an object");
+      }
+      current_ += stamp_size;
+      SkipSpaces();
+      if (current_ == end_ || (*current_ != '0' && *current_ != '1')) {
+        Fail(current_, "expected 0 or 1 for a one way road");
+      }
+      directed = true;
+      one_way = *current_ == '1';
+      ++current_;
+    }
+    geometry::Point from = ParsePoint();
+    geometry::Point to = ParsePoint();
+    double width = ParseNumber();
+    ExpectEndOfLine();
+
+    // The object is created only when its line is parsed, so nothing leaks
+    // on errors.
+    geometry::RectangleObject* object;
+    if (directed) {
+      geometry::DirectedRectangleObject* directed_object =
+          new geometry::DirectedRectangleObject();
+      directed_object->SetIsOneWay(one_way);
+      object = directed_object;
+    } else {
+      object = new geometry::RectangleObject();
+    }
+    object->SetFrom(from);
+    object->SetTo(to);
+    object->SetWidth(width);
+    return object;
+  }
+
+  // The number of bytes left, an upper bound of the number of objects left.
+  unsigned GetRemainingSize() const {
+    return static_cast<unsigned>(end_ - current_);
+  }
+
+ private:
+  // Skips the whitespace, including the ends of lines.
+  void SkipBlankLines() {
+    while (current_ != end_ && IsSpace(*current_)) {
+      if (*current_ == '\n') {
+        ++line_;
+        lineBegin_ = current_ + 1;
+      }
+      ++current_;
+    }
+    if (current_ == end_) {
+      Fail(current_, "unexpected end of file");
+    }
+  }
+
+  // Skips the whitespace on the current line.
+  void SkipSpaces() {
+    while (current_ != end_ && *current_ != '\n' && IsSpace(*current_)) {
+      ++current_;
+    }
+  }
+
+  void ExpectEndOfLine() {
+    SkipSpaces();
+    if (current_ != end_ && *current_ != '\n') {
+      Fail(current_, "expected the end of the line");
+    }
+  }
+
+  void Expect(char expected) {
+    SkipSpaces();
+    if (current_ == end_ || *current_ != expected) {
+      Fail(current_, std::string("expected '") + expected + "'");
+    }
+    ++current_;
+  }
+
+  double ParseNumber() {
+    SkipSpaces();
+    const char* begin = current_;
+    while (current_ != end_ && !IsSpace(*current_) && *current_ != ',' &&
+           *current_ != '(' && *current_ != ')') {
+      ++current_;
+    }
+    // The mapped file is not null terminated, so the number is copied to a
+    // buffer before it is converted.
+    char buffer[MAX_NUMBER_LENGTH + 1];
+    char* number_end = NULL;
+    if (current_ != begin && current_ - begin <= MAX_NUMBER_LENGTH) {
+      std::copy(begin, current_, buffer);
+      buffer[current_ - begin] = 0;
+      double value = strtod(buffer, &number_end);
+      if (number_end == buffer + (current_ - begin)) {
+        return value;
+      }
+    }
+    Fail(begin, "expected a number");
+    return 0.0;
+  }
+
+  geometry::Point ParsePoint() {
+    Expect('(');
+    double x = ParseNumber();
+    Expect(',');
+    double y = ParseNumber();
+    Expect(')');
+    return geometry::Point(x, y);
+  }
+
+  void Fail(const char* position, const std::string& message) const {
+    std::ostringstream error;
+    error << filePath_ << ":" << line_ << ":" << position - lineBegin_ + 1
+          << ": " << message;
+    throw std::runtime_error(error.str());
+  }
+
+ private:
+  const std::string& filePath_;
+  const char* current_;
+  const char* end_;
+  const char* lineBegin_;
+  int line_;
+};
+
+static void ParseObjects(LayoutParser* parser,
+                         RectangleObjectContainer* container) {
+  unsigned count = parser->ParseCount();
+  container->reserve(std::min(count, parser->GetRemainingSize()));
+  for (unsigned index = 0; index < count; ++index) {
+    container->push_back(parser->ParseObject());
+  }
+}
+
+void ObjectHolder::DumpToFile(const std::string& file_path) const {
+  std::ofstream out(file_path.c_str());
+  if (!out) {
+    throw std::runtime_error("Could not open the file to serialize into.");
+    return;
+  }
+
+  out << roadSegments_.size() << std::endl;
+  for (unsigned index = 0; index < roadSegments_.size(); ++index) {
+    out << roadSegments_[index]->Serialize() << std::endl;
+  }
+
+  out << parkingLots_.size() << std::endl;
+  for (unsigned index = 0; index < parkingLots_.size(); ++index) {
+    out << parkingLots_[index]->Serialize() << std::endl;
+  }
+
+  out << obstacles_.size() << std::endl;
+  for (unsigned index = 0; index < obstacles_.size(); ++index) {
+    out << obstacles_[index]->Serialize() << std::endl;
+  }
+}
+
+void ObjectHolder::DumpToBinaryFile(const std::string& file_path) const {
+  const RectangleObjectContainer* sections[] = {
+      &roadSegments_, &parkingLots_, &obstacles_};
+  const unsigned types[] = {
+      ROAD_SEGMENTS_SECTION, PARKING_LOTS_SECTION, OBSTACLES_SECTION};
+  const unsigned number_of_sections = 3;
+
+  std::vector<char> buffer(BINARY_LAYOUT_MAGIC,
+                           BINARY_LAYOUT_MAGIC + sizeof(BINARY_LAYOUT_MAGIC));
+  AppendLittleEndian(BINARY_LAYOUT_VERSION, 4, &buffer);
+  AppendLittleEndian(number_of_sections, 4, &buffer);
+  unsigned long long offset =
+      BINARY_HEADER_SIZE + number_of_sections * BINARY_SECTION_ENTRY_SIZE;
+  for (unsigned section = 0; section < number_of_sections; ++section) {
+    AppendLittleEndian(types[section], 4, &buffer);
+    AppendLittleEndian(sections[section]->size(), 4, &buffer);
+    AppendLittleEndian(offset, 8, &buffer);
+    offset += sections[section]->size() * BINARY_RECORD_SIZE;
+  }
+  for (unsigned section = 0; section < number_of_sections; ++section) {
+    AppendRecords(*sections[section], &buffer);
+  }
+
+  std::ofstream out(file_path.c_str(), std::ios::out | std::ios::binary);
+  if (!out) {
+    throw std::runtime_error("Could not open the file to serialize into.");
+  }
+  out.write(&buffer[0], buffer.size());
+}
+
+void ObjectHolder::ParseFromFile(const std::string& file_path) {
+  MappedFile file(file_path);
+  if (IsBinaryLayout(file.GetData(), file.GetSize())) {
+    DeleteObjects();
+    RectangleObjectContainer* containers[] = {
+        NULL, &roadSegments_, &parkingLots_, &obstacles_};
+    ParseBinaryLayout(file_path, file.GetData(), file.GetSize(), containers);
+    return;
+  }
+
+  LayoutParser parser(file_path, file.GetData(),
+                      file.GetData() + file.GetSize());
+  DeleteObjects();
+  ParseObjects(&parser, &roadSegments_);
+  ParseObjects(&parser, &parkingLots_);
+  ParseObjects(&parser, &obstacles_);
+}
+
+}  // namespace utils
@@ -0,0 +1,111 @@
+#include "utils/thread_pool.h"
+
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace utils {
+
+ThreadPool::ThreadPool(int number_of_threads)
+    : task_(NULL), numberOfTasks_(0), nextTask_(0), busyWorkers_(0),
+      generation_(0), stopping_(false) {
+  if (number_of_threads <= 0) {
+    number_of_threads = static_cast<int>(std::thread::hardware_concurrency());
+  }
+  if (number_of_threads <= 0) {
+    number_of_threads = 1;
+  }
+  // The calling thread is the one with index 0.
+  for (int index = 1; index < number_of_threads; ++index) {
+    workers_.push_back(std::thread(&ThreadPool::WorkerLoop, this, index));
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  workAvailable_.notify_all();
+  for (unsigned index = 0; index < workers_.size(); ++index) {
+    workers_[index].join();
+  }
+}
+
+int ThreadPool::GetNumberOfThreads() const {
+  return static_cast<int>(workers_.size()) + 1;
+}
+
+void ThreadPool::ParallelFor(int number_of_tasks, ParallelTask* task) {
+  if (number_of_tasks <= 0) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    task_ = task;
+    numberOfTasks_ = number_of_tasks;
+    nextTask_ = 0;
+    busyWorkers_ = static_cast<int>(workers_.size());
+    error_ = std::exception_ptr();
+    ++generation_;
+  }
+  workAvailable_.notify_all();
+
+  RunTasks(0);
+
+  std::exception_ptr error;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (busyWorkers_ > 0) {
+      workFinished_.wait(lock);
+    }
+    task_ = NULL;
+    error = error_;
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+void ThreadPool::WorkerLoop(int thread_index) {
+  unsigned seen_generation = 0;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      while (!stopping_ && generation_ == seen_generation) {
+        workAvailable_.wait(lock);
+      }
+      if (stopping_) {
+        return;
+      }
+      seen_generation = generation_;
+    }
+
+    RunTasks(thread_index);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (--busyWorkers_ == 0) {
+      workFinished_.notify_one();
+    }
+  }
+}
+
+void ThreadPool::RunTasks(int thread_index) {
+  while (true) {
+    int task_index = nextTask_++;
+    if (task_index >= numberOfTasks_) {
+      return;
+    }
+    try {
+      task_->Run(task_index, thread_index);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!error_) {
+        error_ = std::current_exception();
+      }
+      nextTask_ = numberOfTasks_;
+    }
+  }
+}
+
+}  // namespace utils